@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <bitcoin/protocol.hpp>
+
+// Measures the cost of CURVE security relative to NULL, both for connection
+// handshakes (with and without a ZAP handler) and for steady state message
+// throughput over tcp loopback, as configured by authenticator::apply.
+// usage: libbitcoin-protocol-bench [handshakes] [messages]
+
+using namespace bc::system;
+using namespace bc::protocol;
+using role = zmq::socket::role;
+using bench_clock = std::chrono::steady_clock;
+
+static const config::endpoint endpoint{ "tcp://127.0.0.1:9100" };
+static const std::string domain{ "benchmark" };
+static constexpr int32_t timeout_milliseconds = 5000;
+
+static double per_second(size_t count, const bench_clock::duration& elapsed)
+{
+    const auto seconds = std::chrono::duration<double>(elapsed).count();
+    return seconds > 0.0 ? static_cast<double>(count) / seconds : 0.0;
+}
+
+static bool receive(zmq::socket& socket, zmq::message& message)
+{
+    zmq::poller poller;
+    poller.add(socket);
+    return poller.wait(timeout_milliseconds).contains(socket.id()) &&
+        socket.receive(message) == zmq::error::success;
+}
+
+// Server sockets are configured by the authenticator (zap) or directly.
+static bool configure(zmq::socket& server, zmq::authenticator* zap,
+    const zmq::certificate& certificate, bool secure)
+{
+    if (zap != nullptr)
+        return zap->apply(server, domain, secure);
+
+    return !secure || (server.set_private_key(certificate.private_key()) &&
+        server.set_curve_server());
+}
+
+// Each handshake is a new client connection that delivers one message.
+static bool handshakes(zmq::context& context, zmq::authenticator* zap,
+    bool secure, size_t count)
+{
+    const zmq::certificate server_certificate{};
+    const zmq::certificate client_certificate{};
+
+    if (zap != nullptr && secure)
+        zap->set_private_key(server_certificate.private_key());
+
+    zmq::socket server(context, role::puller);
+    if (!server || !configure(server, zap, server_certificate, secure) ||
+        server.bind(endpoint) != zmq::error::success)
+        return false;
+
+    const auto start = bench_clock::now();
+    for (size_t handshake = 0; handshake < count; ++handshake)
+    {
+        zmq::socket client(context, role::pusher);
+        if (secure && (
+            !client.set_curve_client(server_certificate.public_key()) ||
+            !client.set_certificate(client_certificate)))
+            return false;
+
+        zmq::message out{};
+        zmq::message in{};
+        out.enqueue(std::string{ "handshake" });
+
+        if (client.connect(endpoint) != zmq::error::success ||
+            client.send(out) != zmq::error::success || !receive(server, in))
+            return false;
+    }
+
+    std::cout << "handshakes "
+        << (secure ? "curve" : "null") << (zap ? " zap" : " no-zap") << ": "
+        << per_second(count, bench_clock::now() - start) << "/s" << std::endl;
+
+    return server.stop();
+}
+
+// Throughput of an established connection, by payload size.
+static bool throughput(zmq::authenticator& zap, bool secure, size_t size,
+    size_t count)
+{
+    const zmq::certificate server_certificate{};
+    const zmq::certificate client_certificate{};
+    zap.set_private_key(server_certificate.private_key());
+
+    zmq::socket server(zap, role::puller);
+    zmq::socket client(zap, role::pusher);
+    if (!server || !client || !zap.apply(server, domain, secure) ||
+        server.bind(endpoint) != zmq::error::success)
+        return false;
+
+    if (secure && (
+        !client.set_curve_client(server_certificate.public_key()) ||
+        !client.set_certificate(client_certificate)))
+        return false;
+
+    if (client.connect(endpoint) != zmq::error::success)
+        return false;
+
+    const data_chunk payload(size, 0x42);
+    zmq::message in{};
+
+    // The first message completes the handshake, excluded from timing.
+    zmq::message first{};
+    first.enqueue(payload);
+    if (client.send(first) != zmq::error::success || !receive(server, in))
+        return false;
+
+    // The client is moved to the sender thread, so sends block on the high
+    // water mark while the server receives.
+    auto sent = true;
+    auto received = true;
+    const auto start = bench_clock::now();
+    std::thread sender([&]()
+    {
+        for (size_t index = 0; index < count && sent; ++index)
+        {
+            zmq::message out{};
+            out.enqueue(payload);
+            sent = (client.send(out) == zmq::error::success);
+        }
+    });
+
+    for (size_t index = 0; index < count && received; ++index)
+        received = receive(server, in);
+
+    sender.join();
+    if (!sent || !received)
+        return false;
+
+    const auto elapsed = bench_clock::now() - start;
+    const auto rate = per_second(count, elapsed);
+    std::cout << "throughput " << (secure ? "curve" : "null") << " "
+        << size << " bytes: " << rate << " msg/s, "
+        << (rate * static_cast<double>(size) / 1048576.0) << " MiB/s"
+        << std::endl;
+
+    return client.stop() && server.stop();
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200;
+    const size_t messages = argc > 2 ? std::strtoul(argv[2], nullptr, 10) :
+        100000;
+
+    auto success = true;
+
+    // Handshakes without a ZAP handler.
+    for (const auto secure: { false, true })
+    {
+        zmq::context context{};
+        success &= handshakes(context, nullptr, secure, count);
+    }
+
+    // Handshakes with a ZAP handler (the address rule engages ZAP for NULL).
+    for (const auto secure: { false, true })
+    {
+        zmq::authenticator authenticator{};
+        authenticator.allow(config::authority{ "127.0.0.1" });
+        success &= authenticator.start() &&
+            handshakes(authenticator, &authenticator, secure, count);
+    }
+
+    // Steady state throughput, as configured by authenticator::apply.
+    for (const auto size: { 64u, 1024u, 65536u })
+    {
+        for (const auto secure: { false, true })
+        {
+            zmq::authenticator authenticator{};
+            authenticator.allow(config::authority{ "127.0.0.1" });
+            success &= authenticator.start() &&
+                throughput(authenticator, secure, size, messages);
+        }
+    }
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -21,16 +21,32 @@
 #include <bitcoin/protocol/settings.hpp>
 #include <bitcoin/protocol/version.hpp>
 #include <bitcoin/protocol/config/sodium.hpp>
+#include <bitcoin/protocol/config/subnet.hpp>
+#include <bitcoin/protocol/zmq/async_client.hpp>
 #include <bitcoin/protocol/zmq/authenticator.hpp>
 #include <bitcoin/protocol/zmq/certificate.hpp>
 #include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/decision_cache.hpp>
 #include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/failover_client.hpp>
 #include <bitcoin/protocol/zmq/frame.hpp>
+#include <bitcoin/protocol/zmq/histogram.hpp>
 #include <bitcoin/protocol/zmq/identifiers.hpp>
+#include <bitcoin/protocol/zmq/key_store.hpp>
+#include <bitcoin/protocol/zmq/last_value_cache.hpp>
 #include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/metrics_server.hpp>
+#include <bitcoin/protocol/zmq/policy_watcher.hpp>
 #include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/rate_limiter.hpp>
+#include <bitcoin/protocol/zmq/sequenced_publisher.hpp>
+#include <bitcoin/protocol/zmq/sequenced_subscriber.hpp>
 #include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/socket_metrics.hpp>
+#include <bitcoin/protocol/zmq/socket_monitor.hpp>
+#include <bitcoin/protocol/zmq/subnet_trie.hpp>
 #include <bitcoin/protocol/zmq/worker.hpp>
+#include <bitcoin/protocol/zmq/zap_metrics.hpp>
 #include <bitcoin/protocol/zmq/zeromq.hpp>
 
 #endif
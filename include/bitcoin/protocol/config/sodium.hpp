@@ -19,6 +19,9 @@
 #ifndef LIBBITCOIN_PROTOCOL_CONFIG_SODIUM_HPP
 #define LIBBITCOIN_PROTOCOL_CONFIG_SODIUM_HPP
 
+#include <array>
+#include <string>
+#include <string_view>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/define.hpp>
 
@@ -31,18 +34,48 @@ class BCP_API sodium
 public:
     DEFAULT_COPY_MOVE_DESTRUCT(sodium);
 
+    /// The number of z85 characters of an encoded key.
+    static constexpr size_t encoded_size = 40;
+
+    /// A z85 encoded key, null terminated (as required by zeromq).
+    typedef std::array<char, system::add1(encoded_size)> z85;
+
+    /// Decode z85 text (without allocation), false if not a valid key.
+    static constexpr bool decode(system::hash_digest& out,
+        std::string_view base85) NOEXCEPT;
+
+    /// Encode the key as z85 text (without allocation).
+    static constexpr z85 encode(const system::hash_digest& value) NOEXCEPT;
+
+    /// Decode z85 text, invalid if not a valid key (usable at compile time).
+    static constexpr sodium from_z85(std::string_view base85) NOEXCEPT;
+
     /// A list of base85 values.
     /// This must provide operator<< for ostream in order to be used as a
     /// boost::program_options default_value.
-    sodium() NOEXCEPT;
+    constexpr sodium() NOEXCEPT
+      : value_(system::null_hash)
+    {
+    }
+
+    constexpr sodium(const system::hash_digest& value) NOEXCEPT
+      : value_(value)
+    {
+    }
+
     sodium(const std::string& base85) THROWS;
-    sodium(const system::hash_digest& value) NOEXCEPT;
 
     /// True if the key is initialized.
-    operator bool() const NOEXCEPT;
+    constexpr operator bool() const NOEXCEPT
+    {
+        return value_ != system::null_hash;
+    }
 
     /// Overload cast to internal type.
-    operator const system::hash_digest&() const NOEXCEPT;
+    constexpr operator const system::hash_digest&() const NOEXCEPT
+    {
+        return value_;
+    }
 
     /// Get the key as a base85 encoded (z85) string.
     std::string to_string() const NOEXCEPT;
@@ -53,9 +86,92 @@ public:
         const sodium& argument) THROWS;
 
 private:
+    static constexpr std::string_view alphabet
+    {
+        "0123456789abcdefghijklmnopqrstuvwxyz"
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ.-:+=^!/*?&<>()[]{}@%$#"
+    };
+
+    // Character values by character, invalid characters are 0xff.
+    static constexpr std::array<uint8_t, 256> digits = []() NOEXCEPT
+    {
+        std::array<uint8_t, 256> out{};
+        out.fill(system::max_uint8);
+
+        for (size_t index = 0; index < alphabet.size(); ++index)
+            out.at(static_cast<uint8_t>(alphabet.at(index))) =
+                static_cast<uint8_t>(index);
+
+        return out;
+    }();
+
     system::hash_digest value_;
 };
 
+// Each four bytes (big endian) are encoded as five base 85 digits.
+constexpr sodium::z85 sodium::encode(const system::hash_digest& value) NOEXCEPT
+{
+    z85 out{};
+    for (size_t word = 0; word < system::hash_size / 4u; ++word)
+    {
+        uint32_t number{};
+        for (size_t byte = 0; byte < 4u; ++byte)
+            number = (number << 8) | value.at(word * 4u + byte);
+
+        for (size_t digit = 5; digit > 0u; --digit)
+        {
+            out.at(word * 5u + digit - 1u) = alphabet.at(number % 85u);
+            number /= 85u;
+        }
+    }
+
+    out.back() = '\0';
+    return out;
+}
+
+// Overflow of a word (possible with five digits) is invalid, and the output
+// is unchanged upon failure.
+constexpr bool sodium::decode(system::hash_digest& out,
+    std::string_view base85) NOEXCEPT
+{
+    if (base85.size() != encoded_size)
+        return false;
+
+    system::hash_digest value{};
+    for (size_t word = 0; word < system::hash_size / 4u; ++word)
+    {
+        uint64_t number{};
+        for (size_t digit = 0; digit < 5u; ++digit)
+        {
+            const auto character = digits.at(static_cast<uint8_t>(
+                base85.at(word * 5u + digit)));
+
+            if (character == system::max_uint8)
+                return false;
+
+            number = number * 85u + character;
+        }
+
+        if (number > system::max_uint32)
+            return false;
+
+        for (size_t byte = 4; byte > 0u; --byte)
+        {
+            value.at(word * 4u + byte - 1u) = static_cast<uint8_t>(number);
+            number >>= 8;
+        }
+    }
+
+    out = value;
+    return true;
+}
+
+constexpr sodium sodium::from_z85(std::string_view base85) NOEXCEPT
+{
+    system::hash_digest value{};
+    return decode(value, base85) ? sodium{ value } : sodium{};
+}
+
 typedef std::vector<sodium> sodiums;
 
 } // namespace protocol
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_CONFIG_SUBNET_HPP
+#define LIBBITCOIN_PROTOCOL_CONFIG_SUBNET_HPP
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+
+/// Serialization helper for ip subnets in CIDR notation (address/prefix).
+/// Addresses are normalized to 128 bits, with ipv4 mapped into ipv6 (and the
+/// ipv4 prefix offset by 96), so that both families share one address space.
+/// An address without a prefix is a single host (/32 or /128).
+class BCP_API subnet
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(subnet);
+
+    /// The number of bits in a normalized address.
+    static constexpr uint8_t maximum_prefix = 128;
+
+    /// Normalize an ip address string (ipv4 or ipv6, optionally bracketed).
+    static bool normalize(ip_address& out, std::string_view host) NOEXCEPT;
+
+    /// The default subnet is the single unspecified address (::/128).
+    subnet() NOEXCEPT;
+    subnet(const std::string& cidr) THROWS;
+
+    /// Host bits of the address beyond the prefix are cleared.
+    subnet(const ip_address& address, uint8_t prefix=maximum_prefix) NOEXCEPT;
+
+    /// The normalized network address.
+    const ip_address& address() const NOEXCEPT;
+
+    /// The normalized prefix length (0..128).
+    uint8_t prefix() const NOEXCEPT;
+
+    /// True if the normalized address is within the subnet.
+    bool contains(const ip_address& address) const NOEXCEPT;
+
+    /// Get the subnet in CIDR notation (ipv4 if mapped).
+    std::string to_string() const NOEXCEPT;
+
+    bool operator==(const subnet& other) const NOEXCEPT;
+
+    friend std::istream& operator>>(std::istream& input,
+        subnet& argument) THROWS;
+    friend std::ostream& operator<<(std::ostream& output,
+        const subnet& argument) THROWS;
+
+private:
+    ip_address address_;
+    uint8_t prefix_;
+};
+
+typedef std::vector<subnet> subnets;
+
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
@@ -57,6 +57,14 @@ struct BCP_API settings
     // ZMQ_RECONNECT_IVL and ZMQ_RECONNECT_IVL_MAX (0 disabled)
     uint32_t reconnect_seconds;
 
+    // Client (connector) setting.
+    // ZMQ_RECONNECT_IVL initial interval (0 default)
+    uint32_t reconnect_milliseconds;
+
+    // Client (connector) setting.
+    // Percentage of reconnect_milliseconds randomly added per socket (0 none)
+    uint32_t reconnect_jitter;
+
     // ZMQ_SNDTIMEO (0 unlimited)
     uint32_t send_milliseconds;
 };
@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_ASYNC_CLIENT_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_ASYNC_CLIENT_HPP
+
+#include <chrono>
+#include <functional>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/settings.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is not thread safe.
+/// All calls must be made on the socket thread.
+/// A pipelined request client over a dealer socket. Each request is sent as
+/// [correlation][][request...] so that replier and router servers return the
+/// correlation in the reply envelope, allowing replies in any order.
+/// The correlation is a little-endian uint32_t.
+class BCP_API async_client
+{
+public:
+    DELETE_COPY_MOVE(async_client);
+
+    /// Invoked upon reply, timeout or stop, with the reply if successful.
+    typedef std::function<void(const error::code&, message&)> handler;
+
+    /// Construct a client allowing up to capacity requests in flight.
+    async_client(context& context, size_t capacity,
+        const settings& settings) NOEXCEPT;
+
+    /// Close the socket (pending handlers are invoked).
+    virtual ~async_client() NOEXCEPT;
+
+    /// True if the socket is valid.
+    operator bool() const NOEXCEPT;
+
+    /// The dealer socket, for polling of replies.
+    socket& dealer() NOEXCEPT;
+
+    /// Connect the socket to the specified server address.
+    error::code connect(const system::config::endpoint& address) NOEXCEPT;
+
+    /// The number of requests in flight.
+    size_t pending() const NOEXCEPT;
+
+    /// True if the number of requests in flight is at capacity.
+    bool full() const NOEXCEPT;
+
+    /// Send the request, the handler is invoked from process or stop.
+    /// Returns error::try_again if full, in which case the handler is not
+    /// retained. The request expires with error::timed_out after timeout.
+    /// Upon failure the handler is not retained. A failure after the first
+    /// part was sent also stops the client, as the socket cannot complete
+    /// the message (pending handlers are invoked).
+    error::code send(message& request, uint32_t timeout_milliseconds,
+        handler&& complete) NOEXCEPT;
+
+    /// Wait up to the timeout (or the earliest deadline) for replies, then
+    /// invoke the handlers of all received replies and expired requests.
+    error::code process(int32_t timeout_milliseconds) NOEXCEPT;
+
+    /// Close the socket (optional), pending handlers are then invoked with
+    /// error::context_terminated. A send from a handler fails (not retained).
+    bool stop() NOEXCEPT;
+
+protected:
+    typedef std::chrono::steady_clock clock;
+    typedef std::pair<clock::time_point, uint32_t> deadline;
+
+    struct request
+    {
+        clock::time_point expiry;
+        handler complete;
+    };
+
+    typedef std::unordered_map<uint32_t, request> requests;
+    typedef std::set<deadline> deadlines;
+
+private:
+    void complete(message& reply) NOEXCEPT;
+    void expire(const clock::time_point& now) NOEXCEPT;
+    int32_t remaining(int32_t timeout_milliseconds) const NOEXCEPT;
+
+    const size_t capacity_;
+    socket dealer_;
+    uint32_t correlation_;
+    requests requests_;
+    deadlines deadlines_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
@@ -19,15 +19,26 @@
 #ifndef LIBBITCOIN_PROTOCOL_ZMQ_AUTHENTICATOR_HPP
 #define LIBBITCOIN_PROTOCOL_ZMQ_AUTHENTICATOR_HPP
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 #include <bitcoin/system.hpp>
+#include <bitcoin/protocol/config/subnet.hpp>
 #include <bitcoin/protocol/define.hpp>
 #include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/key_store.hpp>
 #include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/subnet_trie.hpp>
 #include <bitcoin/protocol/zmq/worker.hpp>
+#include <bitcoin/protocol/zmq/zap_metrics.hpp>
 
 namespace libbitcoin {
 namespace protocol {
@@ -43,11 +54,53 @@ public:
     /// A shared authenticator pointer.
     typedef std::shared_ptr<authenticator> ptr;
 
+    /// ZMTP metadata properties, as name/value pairs (names of 1-255 bytes).
+    typedef std::vector<std::pair<std::string, std::string>> properties;
+
+    /// A user id and metadata attached to the connection of an allowed client,
+    /// readable from each message part received by frame::property.
+    struct grant
+    {
+        std::string user_id{};
+        authenticator::properties properties{};
+    };
+
+    /// A set of allow/deny rules, such as those loaded from a policy file.
+    /// Grants apply to allowed keys (any key of grants is also allowed).
+    struct rules
+    {
+        std::unordered_set<system::hash_digest> keys{};
+        std::unordered_map<system::hash_digest, grant> grants{};
+        std::vector<std::pair<subnet, bool>> subnets{};
+    };
+
+    /// The reason for a ZAP response, each with a fixed status.
+    enum class reason : uint8_t
+    {
+        allowed_null,
+        allowed_curve,
+        address_denied,
+        null_domain_required,
+        null_parameters,
+        null_denied,
+        curve_parameters,
+        curve_key_invalid,
+        curve_key_denied,
+        plain_parameters,
+        plain_unsupported,
+        mechanism_unsupported,
+        malformed,
+        pending_limited,
+        rate_limited
+    };
+
     /// The fixed inprocess authentication endpoint.
     static const system::config::endpoint authentication_point;
 
     /// There may be only one authenticator per process.
-    authenticator(thread_priority priority=thread_priority::normal) NOEXCEPT;
+    /// Requests are evaluated concurrently by the given number of threads.
+    authenticator(thread_priority priority=thread_priority::normal,
+        size_t threads=1) NOEXCEPT;
 
     /// Stop the router.
     virtual ~authenticator() NOEXCEPT;
@@ -69,36 +122,170 @@ public:
     virtual bool apply(socket& socket, const std::string& domain,
         bool secure) NOEXCEPT;
 
+    /// This must be called on the socket thread.
+    /// Apply authentication to the socket for binding to the given endpoint.
+    /// CURVE is applied only to tcp endpoints, as inproc and ipc traffic does
+    /// not leave the host. A nonempty domain is applied to ipc endpoints
+    /// (NULL mechanism, with ZAP), and inproc endpoints are not secured.
+    /// Clients of ipc have no address, so address rules are not applied to
+    /// them within the domain (only).
+    virtual bool apply(socket& socket, const std::string& domain, bool secure,
+        const system::config::endpoint& endpoint) NOEXCEPT;
+
     /// Set the server private key (required for curve security).
     virtual void set_private_key(const sodium& private_key) NOEXCEPT;
 
+    /// Limit pending ZAP requests per domain, zero (default) is unlimited.
+    /// Requests in excess of the limit fail fast with temporary status (300).
+    virtual void set_pending_limit(size_t limit) NOEXCEPT;
+
+    /// Limit handshake attempts per client address and per curve public key
+    /// to the rate (per second) with the given burst, zero rate is unlimited.
+    /// Requests in excess of the limit fail fast with status 400.
+    /// Clients of ipc and inproc endpoints have no address, so all such
+    /// clients share one bucket (keyed by the empty address).
+    /// This must be set before start and takes effect upon start.
+    virtual void set_rate_limit(uint32_t per_second, uint32_t burst) NOEXCEPT;
+
+    /// Cache up to capacity decisions by domain, address, mechanism and key,
+    /// each for the given milliseconds or until the policy is changed.
+    /// Zero capacity or milliseconds (default) disables the cache.
+    /// This must be set before start and takes effect upon start.
+    virtual void set_decision_cache(size_t capacity,
+        uint32_t milliseconds) NOEXCEPT;
+
+    /// Obtain ZAP decision counts, latency and pending depth.
+    /// Counts are cumulative across restarts, pending is zero once stopped.
+    virtual zap_metrics::snapshot metrics() const NOEXCEPT;
+
+    /// Each single rule call below copies and republishes the entire policy,
+    /// so these are intended for small updates. Load many rules with
+    /// allow(rules), remove(rules) or exchange, which publish once.
+
     /// Allow clients with the following public keys (whitelist).
     virtual void allow(const system::hash_digest& public_key) NOEXCEPT;
 
+    /// Allow clients with the following public keys (whitelist), attaching
+    /// the user id and metadata of the grant to their connections.
+    virtual void allow(const system::hash_digest& public_key,
+        const grant& attached) NOEXCEPT;
+
+    /// Allow clients with public keys in the store (whitelist), in addition
+    /// to those allowed individually. Replaces any previously set store.
+    /// False (and not set) if the store is invalid (missing or malformed).
+    virtual bool set_key_store(const key_store::ptr& store) NOEXCEPT;
+
     /// Allow clients with the following ip addresses (whitelist).
     virtual void allow(const system::config::authority& address) NOEXCEPT;
 
     /// Allow clients with the following ip addresses (blacklist).
     virtual void deny(const system::config::authority& address) NOEXCEPT;
 
+    /// Remove a previously allowed public key (and any grant).
+    /// Removing the last key does not revert to allowing all keys.
+    virtual void remove(const system::hash_digest& public_key) NOEXCEPT;
+
+    /// Remove a previously allowed or denied subnet (or address).
+    /// Unlike keys, removing the last allowed subnet reverts to allowing all
+    /// addresses not denied, as whitelisting applies only while any subnet
+    /// is allowed.
+    virtual void remove(const subnet& range) NOEXCEPT;
+
+    /// Atomically add the rules (keys, grants and subnets) in one update.
+    virtual void allow(const rules& next) NOEXCEPT;
+
+    /// Atomically remove the rules (keys, grants and subnets) in one update.
+    virtual void remove(const rules& prior) NOEXCEPT;
+
+    /// Atomically remove the prior rules and add the next rules.
+    /// Rules are not distinguished by source, so a prior rule that was also
+    /// set by allow/deny is removed.
+    virtual void exchange(const rules& prior, const rules& next) NOEXCEPT;
+
+    /// Allow clients within the following subnet (whitelist).
+    /// The rule of the longest matching prefix applies to each client.
+    virtual void allow(const subnet& range) NOEXCEPT;
+
+    /// Deny clients within the following subnet (blacklist).
+    /// The rule of the longest matching prefix applies to each client.
+    virtual void deny(const subnet& range) NOEXCEPT;
+
 protected:
     void work() NOEXCEPT override;
 
 private:
-    bool allowed_address(const std::string& address) const NOEXCEPT;
-    bool allowed_key(const system::hash_digest& public_key) const NOEXCEPT;
-    bool allowed_weak(const std::string& domain) const NOEXCEPT;
+    class zap_request;
+
+    // Transparent, allows lookup of strings by view.
+    struct text_hash
+    {
+        using is_transparent = void;
+        size_t operator()(std::string_view text) const NOEXCEPT
+        {
+            return std::hash<std::string_view>{}(text);
+        }
+    };
+
+    // A grant encoded as ZAP user id and metadata payloads.
+    struct grant_frames
+    {
+        system::data_chunk user_id{};
+        system::data_chunk metadata{};
+    };
+
+    typedef std::shared_ptr<const grant_frames> grant_ptr;
 
-    // This is thread safe.
+    // Immutable once published, replaced in whole on each update.
+    struct policy
+    {
+        // Once any key is allowed, removal never reverts to allowing all.
+        bool restrict_keys{ false };
+        sodium private_key{};
+        std::unordered_set<system::hash_digest> keys{};
+        std::unordered_map<system::hash_digest, grant_ptr> grants{};
+        key_store::ptr store{};
+        std::unordered_set<std::string, text_hash, std::equal_to<>>
+            weak_domains{};
+        std::unordered_set<std::string, text_hash, std::equal_to<>>
+            local_domains{};
+        subnet_trie addresses{};
+    };
+
+    typedef std::shared_ptr<const policy> policy_ptr;
+
+    static grant_ptr encode(const grant& attached) NOEXCEPT;
+    static bool allowed_address(const policy& current,
+        std::string_view domain, std::string_view address) NOEXCEPT;
+    static bool allowed_key(const policy& current,
+        const system::hash_digest& public_key) NOEXCEPT;
+    static bool allowed_weak(const policy& current,
+        std::string_view domain) NOEXCEPT;
+
+    void handle() NOEXCEPT;
+    reason authorize(const zap_request& request,
+        grant_ptr& attached) const NOEXCEPT;
+    policy_ptr snapshot() const NOEXCEPT;
+
+    template <typename Update>
+    void update(Update&& modify) NOEXCEPT;
+
+    // These are thread safe.
+    const size_t threads_;
     context context_;
+    std::atomic<size_t> pending_limit_;
+    std::atomic<uint32_t> rate_limit_;
+    std::atomic<uint32_t> rate_burst_;
+    std::atomic<size_t> cache_capacity_;
+    std::atomic<uint32_t> cache_milliseconds_;
+
+    zap_metrics metrics_;
+
+    // Incremented upon each policy update (invalidates cached decisions).
+    std::atomic<uint64_t> generation_;
 
-    // These are protected by mutex.
-    bool require_allow_;
-    sodium private_key_;
-    std::unordered_set<system::hash_digest> keys_;
-    std::unordered_set<std::string> weak_domains_;
-    std::unordered_map<std::string, bool> adresses_;
-    mutable std::shared_mutex property_mutex_;
+    // This is published atomically, writers are serialized by mutex.
+    policy_ptr policy_;
+    std::mutex update_mutex_;
     mutable std::shared_mutex stop_mutex_;
 };
 
@@ -19,6 +19,8 @@
 #ifndef LIBBITCOIN_PROTOCOL_ZMQ_CERTIFICATE_HPP
 #define LIBBITCOIN_PROTOCOL_ZMQ_CERTIFICATE_HPP
 
+#include <filesystem>
+#include <vector>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/config/sodium.hpp>
 #include <bitcoin/protocol/define.hpp>
@@ -35,6 +37,27 @@ class BCP_API certificate
 public:
     DEFAULT_COPY_MOVE_DESTRUCT(certificate);
 
+    /// A list of certificates.
+    typedef std::vector<certificate> list;
+
+    /// Generate count arbitrary certificates in parallel over the given number
+    /// of threads (zero for hardware concurrency), empty if any fails.
+    /// Set setting false to allow full key space (see default constructor).
+    static list generate(size_t count, size_t threads=0,
+        bool setting=true) NOEXCEPT;
+
+    /// Write certificates to a binary store file (replaces file), each as its
+    /// 32 byte public key followed by its 32 byte private key. The file is
+    /// created with owner access only (where supported) beside the path
+    /// (.tmp) and renamed over it, as it holds private keys.
+    static bool save(const std::filesystem::path& path,
+        const list& certificates) NOEXCEPT;
+
+    /// Read certificates from a binary store file written by save, false if
+    /// the file cannot be read or is malformed. Key pairs are not rederived,
+    /// so the file must be trusted.
+    static bool load(list& out, const std::filesystem::path& path) NOEXCEPT;
+
     /// Construct an arbitary keypair as a new certificate.
     /// This always reduces keyspace, disallowing '#' in text encoding.
     /// Use certificate({ null_hash }) to allow full key space.
@@ -59,6 +82,8 @@ protected:
         bool setting) NOEXCEPT;
 
 private:
+    certificate(const sodium& public_key, const sodium& private_key) NOEXCEPT;
+
     sodium public_;
     sodium private_;
 };
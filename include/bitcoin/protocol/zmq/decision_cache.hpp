@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_DECISION_CACHE_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_DECISION_CACHE_HPP
+
+#include <chrono>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is not thread safe.
+/// Bounded cache of authorization decisions by request key. An entry expires
+/// after the time to live, and is ignored once the policy generation differs
+/// from that at which it was decided. The least recently used entry is
+/// evicted once at capacity.
+class BCP_API decision_cache
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(decision_cache);
+
+    typedef std::chrono::steady_clock clock;
+
+    /// A cached ZAP status, as its authenticator::reason, with any user id and
+    /// metadata granted (empty for the status default).
+    struct decision
+    {
+        uint8_t reason{};
+        system::data_chunk user_id{};
+        system::data_chunk metadata{};
+    };
+
+    /// Zero capacity or zero time to live disables the cache.
+    decision_cache(size_t capacity,
+        const std::chrono::milliseconds& time_to_live) NOEXCEPT;
+
+    /// True if the cache is enabled.
+    bool enabled() const NOEXCEPT;
+
+    /// The number of cached entries (including stale).
+    size_t size() const NOEXCEPT;
+
+    /// Obtain the current decision for the key, false if none.
+    bool find(decision& out, const std::string& key, uint64_t generation,
+        clock::time_point now=clock::now()) NOEXCEPT;
+
+    /// Cache the decision for the key, made at the given policy generation.
+    void insert(const std::string& key, const decision& value,
+        uint64_t generation, clock::time_point now=clock::now()) NOEXCEPT;
+
+private:
+    struct entry
+    {
+        std::string key;
+        decision value;
+        uint64_t generation;
+        clock::time_point expiry;
+    };
+
+    typedef std::list<entry> entries;
+
+    // These are not thread safe.
+    size_t capacity_;
+    std::chrono::milliseconds time_to_live_;
+    entries entries_;
+    std::unordered_map<std::string, entries::iterator> index_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
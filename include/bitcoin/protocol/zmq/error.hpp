@@ -51,7 +51,9 @@ enum error_t
     try_again,
     invalid_message,
     interrupted,
-    invalid_socket
+    invalid_socket,
+    sequence_gap,
+    timed_out
 };
 
 // No current need for error_code equivalence mapping.
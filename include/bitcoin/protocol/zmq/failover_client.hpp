@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_FAILOVER_CLIENT_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_FAILOVER_CLIENT_HPP
+
+#include <chrono>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/settings.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is not thread safe.
+/// All calls must be made on the socket thread.
+/// A reliable request client (lazy pirate pattern). A request that is not
+/// replied to within the timeout is retried on a new requester socket
+/// connected to the next server, with the timeout doubled upon each pass
+/// through the server list. Each retry waits first, starting at the reconnect
+/// interval (settings) and doubling upon each retry. Only lazy pirate is
+/// provided, there is no background heartbeat. To detect a dead server
+/// between requests the owner must call heartbeat() periodically.
+class BCP_API failover_client
+{
+public:
+    DELETE_COPY_MOVE(failover_client);
+
+    /// A list of server endpoints.
+    typedef std::vector<system::config::endpoint> endpoints;
+
+    /// Construct a client of the servers, with up to retries per request.
+    failover_client(context& context, const endpoints& servers,
+        int32_t timeout_milliseconds, size_t retries,
+        const settings& settings) NOEXCEPT;
+
+    /// Close the socket.
+    virtual ~failover_client() NOEXCEPT;
+
+    /// The current server endpoint (undefined if there are no servers).
+    const system::config::endpoint& server() const NOEXCEPT;
+
+    /// Send the request and receive the reply, retrying and failing over
+    /// until replied or retries are exhausted (error::timed_out). The request
+    /// is cleared upon success, otherwise it is retained. Blocks for the
+    /// retry delays in addition to the timeouts.
+    error::code request(message& request, message& reply) NOEXCEPT;
+
+    /// Send an empty request (single empty part), to which any reply is
+    /// sufficient. Fails over to the next server if not replied in time.
+    /// This is not automatic, the owner must call it between requests.
+    error::code heartbeat() NOEXCEPT;
+
+    /// Close the socket (optional), reconnected upon the next request.
+    bool stop() NOEXCEPT;
+
+private:
+    error::code attempt(const message& request, message& reply,
+        int32_t timeout_milliseconds) NOEXCEPT;
+    std::chrono::milliseconds delay(size_t retry) const NOEXCEPT;
+    void fail_over() NOEXCEPT;
+
+    context& context_;
+    const endpoints servers_;
+    const int32_t timeout_;
+    const size_t retries_;
+    const settings settings_;
+    size_t server_;
+    socket::ptr requester_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
@@ -20,6 +20,7 @@
 #define LIBBITCOIN_PROTOCOL_ZMQ_FRAME_HPP
 
 #include <memory>
+#include <string>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/define.hpp>
 #include <bitcoin/protocol/zmq/error.hpp>
@@ -46,6 +47,10 @@ public:
     /// Construct a frame with the specified payload (for sending).
     frame(const system::data_chunk& data) NOEXCEPT;
 
+    /// Construct a frame that takes ownership of the payload (for sending).
+    /// Larger payloads are not copied, and are freed when no longer sent.
+    frame(system::data_chunk&& data) NOEXCEPT;
+
     /// Free the frame's allocated memory.
     ~frame() NOEXCEPT;
 
@@ -58,6 +63,13 @@ public:
     /// The initialized or received payload of the frame.
     system::data_chunk payload() const NOEXCEPT;
 
+    /// A view of the payload (not copied), valid until the frame is changed.
+    system::data_slice view() const NOEXCEPT;
+
+    /// A metadata property of the received frame (zmq_msg_gets), such as
+    /// "User-Id" or a name set by the authenticator, empty if not present.
+    std::string property(const std::string& name) const NOEXCEPT;
+
     /// Must be called on the socket thread.
     /// Receive a frame on the socket.
     error::code receive(socket& socket) NOEXCEPT;
@@ -66,8 +78,14 @@ public:
     /// Send a frame on the socket.
     error::code send(socket& socket, bool last) NOEXCEPT;
 
+    /// Must be called on the socket thread.
+    /// Send a reference to the payload on the socket, retaining the payload.
+    /// The payload is not copied, so may be shared by any number of sockets.
+    error::code share(socket& socket, bool last) NOEXCEPT;
+
 private:
     bool initialize(const system::data_chunk& data) NOEXCEPT;
+    bool initialize(system::data_chunk&& data) NOEXCEPT;
     bool set_more(socket& socket) NOEXCEPT;
     bool destroy() NOEXCEPT;
 
@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_HISTOGRAM_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_HISTOGRAM_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe.
+/// Log-linear (HDR style) histogram of durations in microseconds. Each power
+/// of two is divided into four linear sub-buckets, so a recorded value is
+/// resolved within 25%, with the last bucket unbounded (over ~125 minutes).
+/// Counts are relaxed atomics, so a snapshot is not a consistent cut.
+class BCP_API histogram
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(histogram);
+
+    typedef std::chrono::steady_clock clock;
+
+    /// The number of buckets.
+    static constexpr size_t buckets = 128;
+
+    /// A copy of the counts.
+    struct snapshot
+    {
+        /// Counts by bucket.
+        std::array<uint64_t, buckets> counts{};
+
+        /// The number and sum (microseconds) of recorded durations.
+        uint64_t count{};
+        uint64_t sum{};
+
+        /// The largest recorded duration (microseconds).
+        uint64_t maximum{};
+
+        /// The lower bound (microseconds) of the bucket at the quantile [0, 1].
+        uint64_t quantile(double fraction) const NOEXCEPT;
+    };
+
+    /// The bucket of a duration in microseconds.
+    static size_t bucket(uint64_t microseconds) NOEXCEPT;
+
+    /// The smallest duration (microseconds) within the bucket.
+    static uint64_t lower_bound(size_t bucket) NOEXCEPT;
+
+    histogram() NOEXCEPT;
+
+    /// Record a duration.
+    void record(const clock::duration& duration) NOEXCEPT;
+
+    /// Copy the counts.
+    snapshot get() const NOEXCEPT;
+
+private:
+    typedef std::atomic<uint64_t> counter;
+
+    // These are thread safe.
+    std::array<counter, buckets> counts_;
+    counter count_;
+    counter sum_;
+    counter maximum_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
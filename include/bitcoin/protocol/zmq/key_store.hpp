@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_KEY_STORE_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_KEY_STORE_HPP
+
+#include <filesystem>
+#include <memory>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// Read-only memory-mapped file of sorted, unique curve public keys.
+/// The file is the concatenation of 32 byte keys in lexical order, so it is
+/// queried in place (binary search) without loading, and its pages are
+/// shared across processes by the operating system page cache.
+/// This class is thread safe.
+class BCP_API key_store
+{
+public:
+    DELETE_COPY_MOVE(key_store);
+
+    /// A shared key store pointer.
+    typedef std::shared_ptr<const key_store> ptr;
+
+    /// Sort, deduplicate and write keys to a store file. The file is written
+    /// beside the path (.tmp) and renamed over it, so existing mappings of
+    /// the replaced file remain valid.
+    static bool create(const std::filesystem::path& path,
+        system::hashes keys) NOEXCEPT;
+
+    /// Map the file, invalid if the file cannot be mapped or is malformed
+    /// (including unsorted or duplicated keys, verified upon construct).
+    /// An invalid store is unmapped and has zero size, so check it before use.
+    key_store(const std::filesystem::path& path) NOEXCEPT;
+
+    /// Unmap the file.
+    virtual ~key_store() NOEXCEPT;
+
+    /// True if the file is mapped (false if missing or malformed).
+    operator bool() const NOEXCEPT;
+
+    /// The number of keys in the store.
+    size_t size() const NOEXCEPT;
+
+    /// True if the key is in the store, O(log(n)).
+    bool contains(const system::hash_digest& public_key) const NOEXCEPT;
+
+private:
+    void unmap() NOEXCEPT;
+
+    // These are not thread safe, but are not mutated after construct.
+    const uint8_t* memory_;
+    size_t length_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
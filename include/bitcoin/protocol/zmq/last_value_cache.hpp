@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_LAST_VALUE_CACHE_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_LAST_VALUE_CACHE_HPP
+
+#include <map>
+#include <memory>
+#include <boost/circular_buffer.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/settings.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/worker.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe.
+/// A last value cache proxy between publisher(s) and subscribers. The last
+/// messages of each topic (first message part) are retained and replayed to
+/// the subscribers of the topic when a subscription is received. Existing
+/// subscribers to a topic also receive its replay upon a new subscription.
+class BCP_API last_value_cache
+  : public worker
+{
+public:
+    DELETE_COPY_MOVE(last_value_cache);
+
+    /// A shared last value cache pointer.
+    typedef std::shared_ptr<last_value_cache> ptr;
+
+    /// Construct a cache of the last depth messages of each topic.
+    /// Subscribes to all topics of the upstream publisher (connect) and
+    /// publishes to subscribers of the downstream endpoint (bind).
+    last_value_cache(context& context,
+        const system::config::endpoint& upstream,
+        const system::config::endpoint& downstream, size_t depth,
+        const settings& settings,
+        thread_priority priority=thread_priority::normal) NOEXCEPT;
+
+    /// Stop the cache.
+    virtual ~last_value_cache() NOEXCEPT;
+
+protected:
+    typedef boost::circular_buffer<message> ring;
+    typedef std::map<system::data_chunk, ring> topics;
+
+    void work() NOEXCEPT override;
+
+private:
+    void cache(socket& subscriber, socket& publisher) NOEXCEPT;
+    void replay(socket& publisher) NOEXCEPT;
+
+    // This is thread safe.
+    context& context_;
+
+    // These are thread safe (const).
+    const system::config::endpoint upstream_;
+    const system::config::endpoint downstream_;
+    const size_t depth_;
+    const settings settings_;
+
+    // This is protected by the work thread.
+    topics topics_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
@@ -98,6 +98,9 @@ public:
     bool dequeue(system::hash_digest& value) NOEXCEPT;
     bool dequeue(address& value) NOEXCEPT;
 
+    /// The message part at the top of the queue, empty if empty queue.
+    const system::data_chunk& front() const NOEXCEPT;
+
     /// Clear the queue of message parts.
     void clear() NOEXCEPT;
 
@@ -111,6 +114,11 @@ public:
     /// Send the message in parts. If a send fails the unsent parts remain.
     error::code send(socket& socket) NOEXCEPT;
 
+    /// Must be called on the thread of each socket.
+    /// Send the message to each socket, sharing a single copy of each part.
+    /// The queue is cleared, a failed send does not preclude other sockets.
+    error::code send(const sockets& sockets) NOEXCEPT;
+
     /// Must be called on the socket thread.
     /// Receve a message (clears the queue first).
     error::code receive(socket& socket) NOEXCEPT;
@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_METRICS_SERVER_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_METRICS_SERVER_HPP
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/authenticator.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/socket_metrics.hpp>
+#include <bitcoin/protocol/zmq/socket_monitor.hpp>
+#include <bitcoin/protocol/zmq/worker.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe.
+/// Serves the statistics of added sources in Prometheus text format (0.0.4)
+/// over http on a stream socket. Each request is answered with a snapshot
+/// and the connection is closed. Sources are identified by the "source"
+/// label and snapshots are read from atomics (without blocking the sources).
+class BCP_API metrics_server
+  : public worker
+{
+public:
+    DELETE_COPY_MOVE(metrics_server);
+
+    /// A shared metrics server pointer.
+    typedef std::shared_ptr<metrics_server> ptr;
+
+    /// Construct a metrics server for the given endpoint (tcp or ipc).
+    metrics_server(context& context, const system::config::endpoint& endpoint,
+        thread_priority priority=thread_priority::normal) NOEXCEPT;
+
+    /// Stop the server.
+    virtual ~metrics_server() NOEXCEPT;
+
+    /// Add a source of socket traffic statistics.
+    virtual void add(const std::string& name,
+        const socket_metrics::ptr& source) NOEXCEPT;
+
+    /// Add a source of socket event statistics.
+    virtual void add(const std::string& name,
+        const socket_monitor::ptr& source) NOEXCEPT;
+
+    /// Add a source of ZAP decision statistics.
+    virtual void add(const std::string& name,
+        const authenticator::ptr& source) NOEXCEPT;
+
+    /// Render the statistics of all sources in Prometheus text format.
+    virtual std::string report() const NOEXCEPT;
+
+protected:
+    void work() NOEXCEPT override;
+
+private:
+    template <typename Source>
+    using sources = std::vector<std::pair<std::string, Source>>;
+
+    void respond(socket& server) const NOEXCEPT;
+
+    // These are thread safe.
+    context& context_;
+    const system::config::endpoint endpoint_;
+
+    // These are protected by mutex.
+    sources<socket_metrics::ptr> sockets_;
+    sources<socket_monitor::ptr> monitors_;
+    sources<authenticator::ptr> authenticators_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
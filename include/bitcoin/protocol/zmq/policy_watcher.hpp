@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_POLICY_WATCHER_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_POLICY_WATCHER_HPP
+
+#include <filesystem>
+#include <istream>
+#include <memory>
+#include <string>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
+#include <bitcoin/protocol/zmq/authenticator.hpp>
+#include <bitcoin/protocol/zmq/worker.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe.
+/// Applies the rules of a policy file to an authenticator and reapplies them
+/// upon change of the file. On linux a completed write or rename of the file
+/// is notified (inotify), otherwise the content is polled and a change is
+/// applied once unchanged for an interval. Each reload atomically replaces
+/// the rules of the previous load, so rules removed from the file are removed
+/// from the authenticator. A file that cannot be read or parsed, or that has
+/// no rules (such as when truncated), leaves the current rules in effect.
+///
+/// File format, one rule per line, with blank lines and # comments ignored:
+///     allow <z85 curve public key> [user id] [<name>=<value> ...]
+///     allow <address or cidr subnet>
+///     deny <address or cidr subnet>
+/// A user id or metadata properties following a key are granted to clients
+/// of the key (see authenticator::grant).
+class BCP_API policy_watcher
+  : public worker
+{
+public:
+    DELETE_COPY_MOVE(policy_watcher);
+
+    /// A shared policy watcher pointer.
+    typedef std::shared_ptr<policy_watcher> ptr;
+
+    /// Parse policy rules from a stream, false if malformed.
+    static bool parse(authenticator::rules& out, std::istream& input) NOEXCEPT;
+
+    /// Construct a watcher of the policy file, start fails if not loaded.
+    policy_watcher(authenticator& authenticator,
+        const std::filesystem::path& path,
+        thread_priority priority=thread_priority::normal) NOEXCEPT;
+
+    /// Stop the watcher.
+    virtual ~policy_watcher() NOEXCEPT;
+
+protected:
+    void work() NOEXCEPT override;
+
+private:
+    bool read(std::string& out) const NOEXCEPT;
+    bool apply(const std::string& content) NOEXCEPT;
+
+    // This is thread safe.
+    authenticator& authenticator_;
+
+    // This is thread safe (const).
+    const std::filesystem::path path_;
+
+    // These are used only on the worker thread.
+    authenticator::rules rules_;
+    std::string content_;
+    std::string staged_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
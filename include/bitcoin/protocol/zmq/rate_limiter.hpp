@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_RATE_LIMITER_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_RATE_LIMITER_HPP
+
+#include <chrono>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is not thread safe.
+/// Token bucket rate limiter over arbitrary keys (such as addresses or public
+/// keys). Each key receives a bucket of burst tokens, refilled at rate tokens
+/// per second. Memory is bounded by capacity, with the least recently used
+/// bucket evicted (an evicted key subsequently receives a full bucket).
+class BCP_API rate_limiter
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(rate_limiter);
+
+    typedef std::chrono::steady_clock clock;
+
+    /// Zero rate is unlimited, zero burst is taken as one.
+    rate_limiter(uint32_t rate, uint32_t burst, size_t capacity) NOEXCEPT;
+
+    /// The number of tracked buckets.
+    size_t size() const NOEXCEPT;
+
+    /// Consume a token for the key, false if none available.
+    bool admit(const std::string& key,
+        clock::time_point now=clock::now()) NOEXCEPT;
+
+private:
+    struct bucket
+    {
+        std::string key;
+        double tokens;
+        clock::time_point updated;
+    };
+
+    typedef std::list<bucket> buckets;
+
+    // These are not thread safe.
+    double rate_;
+    double burst_;
+    size_t capacity_;
+    buckets buckets_;
+    std::unordered_map<std::string, buckets::iterator> index_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
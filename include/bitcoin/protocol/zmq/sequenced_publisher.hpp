@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_SEQUENCED_PUBLISHER_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_SEQUENCED_PUBLISHER_HPP
+
+#include <map>
+#include <utility>
+#include <boost/circular_buffer.hpp>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/settings.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is not thread safe.
+/// All calls must be made on the socket thread.
+/// A publisher that stamps each message with a sequence of its topic (first
+/// message part) and retains the last messages of each topic for recovery.
+/// Published:         [topic][sequence][payload...]
+/// Recovery request:  [request][topic][first][last]
+/// Recovery response: [request][topic][sequence][payload...] for each
+///                    retained message in the requested range, followed by
+///                    [request][topic].
+/// Sequences are little-endian uint64_t, starting at one for each topic.
+/// The request identifier is a little-endian uint32_t, echoed in responses.
+class BCP_API sequenced_publisher
+{
+public:
+    DELETE_COPY_MOVE(sequenced_publisher);
+
+    /// Construct a publisher retaining the last retention messages by topic.
+    sequenced_publisher(context& context, size_t retention,
+        const settings& settings) NOEXCEPT;
+
+    /// Close the sockets.
+    virtual ~sequenced_publisher() NOEXCEPT;
+
+    /// True if the sockets are valid.
+    operator bool() const NOEXCEPT;
+
+    /// The recovery (router) socket, for polling of recovery requests.
+    socket& recovery() NOEXCEPT;
+
+    /// Bind the publisher and recovery sockets to the specified addresses.
+    error::code bind(const system::config::endpoint& publisher,
+        const system::config::endpoint& recovery) NOEXCEPT;
+
+    /// Stamp the message with the next sequence of its topic and send it.
+    /// The message is retained even if the send fails or is dropped.
+    error::code send(message& packet) NOEXCEPT;
+
+    /// Respond to all pending recovery requests (does not block).
+    error::code retransmit() NOEXCEPT;
+
+    /// Close the sockets (optional).
+    bool stop() NOEXCEPT;
+
+protected:
+    typedef std::pair<uint64_t, message> sequenced;
+    typedef boost::circular_buffer<sequenced> ring;
+
+    struct topic
+    {
+        uint64_t sequence;
+        ring retained;
+    };
+
+    typedef std::map<system::data_chunk, topic> topics;
+
+private:
+    error::code respond(const message::address& route, uint32_t identifier,
+        const system::data_chunk& name, uint64_t first,
+        uint64_t last) NOEXCEPT;
+
+    const size_t retention_;
+    socket publisher_;
+    socket recovery_;
+    topics topics_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
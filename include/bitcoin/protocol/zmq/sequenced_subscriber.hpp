@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_SEQUENCED_SUBSCRIBER_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_SEQUENCED_SUBSCRIBER_HPP
+
+#include <map>
+#include <queue>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/settings.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is not thread safe.
+/// All calls must be made on the socket thread.
+/// A subscriber to a sequenced_publisher, which detects sequence gaps by
+/// topic and recovers missed messages over the publisher's recovery channel.
+class BCP_API sequenced_subscriber
+{
+public:
+    DELETE_COPY_MOVE(sequenced_subscriber);
+
+    /// Construct a subscriber waiting up to timeout for gap recovery.
+    sequenced_subscriber(context& context, int32_t timeout_milliseconds,
+        const settings& settings) NOEXCEPT;
+
+    /// Close the sockets.
+    virtual ~sequenced_subscriber() NOEXCEPT;
+
+    /// True if the sockets are valid.
+    operator bool() const NOEXCEPT;
+
+    /// The subscriber socket, for polling of received messages.
+    socket& subscriber() NOEXCEPT;
+
+    /// Connect the subscriber and recovery sockets to the publisher.
+    error::code connect(const system::config::endpoint& publisher,
+        const system::config::endpoint& recovery) NOEXCEPT;
+
+    /// Receive the next message of any topic in sequence order (blocking).
+    /// The topic and sequence parts are removed from the payload message.
+    /// Missed messages are recovered and returned in order before the next.
+    /// Returns error::sequence_gap for the first of any unrecoverable range,
+    /// with payload empty, after which subsequent messages are returned.
+    error::code receive(system::data_chunk& topic, uint64_t& sequence,
+        message& payload) NOEXCEPT;
+
+    /// Close the sockets (optional).
+    bool stop() NOEXCEPT;
+
+protected:
+    struct entry
+    {
+        system::data_chunk topic;
+        uint64_t sequence;
+        message payload;
+        bool gap;
+    };
+
+    typedef std::queue<entry> entries;
+    typedef std::map<system::data_chunk, uint64_t> sequences;
+
+private:
+    void recover(const system::data_chunk& topic, uint64_t first,
+        uint64_t last) NOEXCEPT;
+
+    const int32_t timeout_;
+    socket subscriber_;
+    socket recovery_;
+    sequences delivered_;
+    entries pending_;
+    uint32_t request_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
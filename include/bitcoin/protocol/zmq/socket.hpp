@@ -19,7 +19,9 @@
 #ifndef LIBBITCOIN_PROTOCOL_ZMQ_SOCKET_HPP
 #define LIBBITCOIN_PROTOCOL_ZMQ_SOCKET_HPP
 
+#include <functional>
 #include <memory>
+#include <vector>
 #include <bitcoin/protocol/config/sodium.hpp>
 #include <bitcoin/protocol/define.hpp>
 #include <bitcoin/protocol/settings.hpp>
@@ -27,6 +29,7 @@
 #include <bitcoin/protocol/zmq/context.hpp>
 #include <bitcoin/protocol/zmq/error.hpp>
 #include <bitcoin/protocol/zmq/identifiers.hpp>
+#include <bitcoin/protocol/zmq/socket_metrics.hpp>
 
 namespace libbitcoin {
 namespace protocol {
@@ -123,25 +126,44 @@ public:
     /// Configure subscriber socket to remove the message filter.
     bool set_unsubscription(const system::data_chunk& filter) NOEXCEPT;
 
+    /// Configure extended publisher socket to pass all subscriptions.
+    bool set_verbose_subscriptions() NOEXCEPT;
+
     /// Send a message on this socket.
     error::code send(message& packet) NOEXCEPT;
 
     /// Receive a message from this socket.
     error::code receive(message& packet) NOEXCEPT;
 
+    /// Record traffic and call latency of this socket to the metrics, which
+    /// may be shared by sockets (on any thread). Null (default) disables.
+    void set_metrics(const socket_metrics::ptr& metrics) NOEXCEPT;
+
+    /// The metrics of this socket, or null if not set.
+    socket_metrics* metrics() const NOEXCEPT;
+
 protected:
     static int to_socket_type(role socket_role) NOEXCEPT;
 
+    /// The initial reconnect interval, milliseconds (zero for the default)
+    /// plus a random amount up to jitter percent of it.
+    static int32_t reconnect_interval(uint32_t milliseconds,
+        uint32_t jitter) NOEXCEPT;
+
     bool set32(int32_t option, int32_t value) NOEXCEPT;
     bool set64(int32_t option, int64_t value) NOEXCEPT;
     bool set(int32_t option, const std::string& value) NOEXCEPT;
     bool set(int32_t option, const system::data_chunk& value) NOEXCEPT;
+    bool set(int32_t option, const system::hash_digest& value) NOEXCEPT;
 
 private:
     void* self_;
     const identifier identifier_;
+    socket_metrics::ptr metrics_;
 };
 
+typedef std::vector<std::reference_wrapper<socket>> sockets;
+
 } // namespace zmq
 } // namespace protocol
 } // namespace libbitcoin
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_SOCKET_METRICS_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_SOCKET_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/histogram.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe.
+/// Traffic counters and call latency histograms of one or more sockets, as
+/// recorded by each frame sent or received (see socket::set_metrics). Counters
+/// are updated independently, so a snapshot is not a consistent cut.
+class BCP_API socket_metrics
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(socket_metrics);
+
+    /// A shared socket metrics pointer.
+    typedef std::shared_ptr<socket_metrics> ptr;
+
+    typedef histogram::clock clock;
+
+    /// Failures are counted by error::error_t, with larger values as unknown.
+    static constexpr size_t errors = 32;
+
+    /// A copy of the counters.
+    struct snapshot
+    {
+        /// Messages (final parts) and bytes (of all parts).
+        uint64_t messages_sent{};
+        uint64_t bytes_sent{};
+        uint64_t messages_received{};
+        uint64_t bytes_received{};
+
+        /// Failed sends by error::error_t, where try_again is a send that
+        /// could not complete at the high water mark within the timeout.
+        std::array<uint64_t, errors> send_failures{};
+
+        /// Failed receives (including timeouts and termination).
+        uint64_t receive_failures{};
+
+        /// Latency of each send and receive call (of a part), successful or
+        /// not. The sum of each is the time blocked in the respective call.
+        histogram::snapshot send_latency{};
+        histogram::snapshot receive_latency{};
+    };
+
+    socket_metrics() NOEXCEPT;
+
+    /// Record a send of a message part, the last part completes a message.
+    void sent(size_t bytes, bool last, const error::code& ec,
+        const clock::duration& latency) NOEXCEPT;
+
+    /// Record a receive of a message part, the last part completes a message.
+    void received(size_t bytes, bool last, const error::code& ec,
+        const clock::duration& latency) NOEXCEPT;
+
+    /// Copy the counters.
+    snapshot get() const NOEXCEPT;
+
+private:
+    typedef std::atomic<uint64_t> counter;
+
+    // These are thread safe.
+    counter messages_sent_;
+    counter bytes_sent_;
+    counter messages_received_;
+    counter bytes_received_;
+    std::array<counter, errors> send_failures_;
+    counter receive_failures_;
+    histogram send_latency_;
+    histogram receive_latency_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_SOCKET_MONITOR_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_SOCKET_MONITOR_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/histogram.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/worker.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe.
+/// Observes the connection events of a socket (zmq_socket_monitor) over an
+/// inproc pair, counting events by type and timing handshakes. Each event is
+/// passed to the handler (on the monitor thread) and retained for pop.
+/// Start the monitor before the socket is bound or connected, and stop (close)
+/// the monitored socket before the monitor.
+class BCP_API socket_monitor
+  : public worker
+{
+public:
+    DELETE_COPY_MOVE(socket_monitor);
+
+    /// A shared socket monitor pointer.
+    typedef std::shared_ptr<socket_monitor> ptr;
+
+    typedef std::chrono::steady_clock clock;
+
+    /// The socket events defined by zeromq, in order of event bit.
+    enum class event_type : uint8_t
+    {
+        connected,
+        connect_delayed,
+        connect_retried,
+        listening,
+        bind_failed,
+        accepted,
+        accept_failed,
+        closed,
+        close_failed,
+        disconnected,
+        monitor_stopped,
+        handshake_failed_no_detail,
+        handshake_succeeded,
+        handshake_failed_protocol,
+        handshake_failed_auth,
+        unknown
+    };
+
+    /// The number of distinct event types.
+    static constexpr size_t event_types = 16;
+
+    /// An observed socket event.
+    struct event
+    {
+        event_type type{ event_type::unknown };
+
+        /// The event value (file descriptor, interval, errno or zmtp code).
+        uint32_t value{};
+
+        /// The endpoint address of the connection or listener.
+        std::string address{};
+
+        /// The time the event was observed.
+        clock::time_point time{};
+
+        /// For handshake events, the time since the connection (or accept).
+        clock::duration handshake{};
+    };
+
+    /// A copy of the counters.
+    struct snapshot
+    {
+        /// Events by event_type.
+        std::array<uint64_t, event_types> events{};
+
+        /// Handshake duration histogram (succeeded and failed).
+        histogram::snapshot handshakes{};
+    };
+
+    /// Invoked on the monitor thread for each event.
+    typedef std::function<void(const event&)> handler;
+
+    /// This must be called on the socket thread, which must be of context.
+    /// Retain up to the given number of events for pop (oldest discarded).
+    socket_monitor(context& context, socket& socket, handler&& notify={},
+        size_t retain=zero,
+        thread_priority priority=thread_priority::normal) NOEXCEPT;
+
+    /// Stop the monitor.
+    virtual ~socket_monitor() NOEXCEPT;
+
+    /// Remove the oldest retained event, false if none retained.
+    virtual bool pop(event& out) NOEXCEPT;
+
+    /// Obtain event counts and the handshake duration histogram.
+    /// Counts are cumulative across restarts.
+    virtual snapshot metrics() const NOEXCEPT;
+
+protected:
+    void work() NOEXCEPT override;
+
+private:
+    typedef std::atomic<uint64_t> counter;
+
+    // A connection (file descriptor) awaiting its handshake.
+    struct opening
+    {
+        uint32_t descriptor;
+        clock::time_point time;
+    };
+
+    void receive(socket& monitor) NOEXCEPT;
+    void open(const event& observed) NOEXCEPT;
+    void close(const event& observed) NOEXCEPT;
+    void handshake(event& observed) NOEXCEPT;
+    void retain(const event& observed) NOEXCEPT;
+
+    // These are thread safe.
+    context& context_;
+    const std::string endpoint_;
+    const bool registered_;
+    const handler handler_;
+    const size_t retain_;
+    std::array<counter, event_types> events_;
+    histogram handshakes_;
+
+    // These are protected by mutex.
+    std::deque<event> retained_;
+    mutable std::mutex mutex_;
+
+    // These are not thread safe (monitor thread only).
+    std::unordered_map<std::string, std::deque<opening>> opened_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
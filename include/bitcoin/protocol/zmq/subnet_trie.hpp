@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_SUBNET_TRIE_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_SUBNET_TRIE_HPP
+
+#include <array>
+#include <vector>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/config/subnet.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// Path compressed binary radix trie of allow/deny rules over normalized
+/// 128 bit addresses. Lookup returns the rule of the longest matching prefix
+/// in O(prefix). Each node is a rule or a branch, so there are fewer than
+/// two nodes per rule (independent of prefix length), and nodes released by
+/// erase are reused by insert. The trie is therefore copied in O(rules).
+/// This class is not thread safe.
+class BCP_API subnet_trie
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(subnet_trie);
+
+    subnet_trie() NOEXCEPT;
+
+    /// The number of rules.
+    size_t size() const NOEXCEPT;
+
+    /// True if there are no rules.
+    bool empty() const NOEXCEPT;
+
+    /// The number of allow rules.
+    size_t allows() const NOEXCEPT;
+
+    /// The number of nodes in use (including the root).
+    size_t nodes() const NOEXCEPT;
+
+    /// Insert a rule, false if a rule exists for the subnet (retained).
+    bool insert(const subnet& range, bool allow) NOEXCEPT;
+
+    /// Remove the rule for the subnet, false if not found.
+    bool erase(const subnet& range) NOEXCEPT;
+
+    /// Obtain the rule of the longest matching prefix, false if none.
+    bool find(bool& allow, const ip_address& address) const NOEXCEPT;
+
+private:
+    enum class rule : uint8_t
+    {
+        none,
+        allow,
+        deny
+    };
+
+    // Only the leading prefix bits of the address are significant.
+    struct node
+    {
+        ip_address address{};
+        std::array<uint32_t, 2> children{};
+        uint8_t prefix{};
+        rule value{ rule::none };
+    };
+
+    static size_t common(const ip_address& left, const ip_address& right,
+        size_t limit) NOEXCEPT;
+
+    uint32_t allocate(const ip_address& address, size_t prefix) NOEXCEPT;
+    void release(uint32_t index) NOEXCEPT;
+
+    // The root is node zero (prefix zero), so zero also indicates no child.
+    std::vector<node> nodes_;
+    std::vector<uint32_t> free_;
+    size_t size_;
+    size_t allows_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_ZAP_METRICS_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_ZAP_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/histogram.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+/// This class is thread safe.
+/// Counters of ZAP decisions by status code and by reason, a histogram of
+/// request latency and the depth of pending requests. Counters are updated
+/// independently, so a snapshot is not a consistent cut across counters.
+class BCP_API zap_metrics
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(zap_metrics);
+
+    typedef histogram::clock clock;
+
+    /// The number of distinct reasons (authenticator::reason).
+    static constexpr size_t reasons = 15;
+
+    /// A copy of the counters.
+    struct snapshot
+    {
+        /// Decisions by status code.
+        uint64_t success{};
+        uint64_t temporary{};
+        uint64_t failure{};
+        uint64_t internal{};
+
+        /// Decisions by authenticator::reason.
+        std::array<uint64_t, reasons> decisions{};
+
+        /// Request latency histogram.
+        histogram::snapshot latency{};
+
+        /// Requests dispatched to handlers and not yet answered.
+        uint64_t pending{};
+    };
+
+    zap_metrics() NOEXCEPT;
+
+    /// Count a decision by reason and status code (200, 300, 400, 500).
+    void record(size_t reason, uint16_t code,
+        const clock::duration& latency) NOEXCEPT;
+
+    /// Set the current depth of pending requests.
+    void set_pending(size_t depth) NOEXCEPT;
+
+    /// Copy the counters.
+    snapshot get() const NOEXCEPT;
+
+private:
+    typedef std::atomic<uint64_t> counter;
+
+    // These are thread safe.
+    counter success_;
+    counter temporary_;
+    counter failure_;
+    counter internal_;
+    std::array<counter, reasons> decisions_;
+    histogram latency_;
+    counter pending_;
+};
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
+
+#endif
@@ -38,6 +38,9 @@ constexpr int32_t zmq_fail = -1;
 constexpr int32_t zmq_reconnect_interval = 100;
 constexpr size_t zmq_encoded_key_size = 40;
 
+// Smaller payloads are copied into a message, as this avoids allocation.
+constexpr size_t zmq_minimum_shared_size = 64;
+
 // This is the maximum safe value on all platforms, due to zeromq bug.
 constexpr int32_t zmq_maximum_safe_wait_milliseconds = 1000;
 
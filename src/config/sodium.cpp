@@ -18,8 +18,9 @@
  */
 #include <bitcoin/protocol/config/sodium.hpp>
 
-#include <algorithm>
-#include <sstream>
+#include <istream>
+#include <ostream>
+#include <string>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/define.hpp>
 
@@ -28,39 +29,19 @@ namespace protocol {
 
 using namespace bc::system;
 
-sodium::sodium() NOEXCEPT
-  : value_(null_hash)
-{
-}
-
 sodium::sodium(const std::string& base85) THROWS
   : sodium()
 {
-    std::stringstream(base85) >> *this;
-}
-
-sodium::sodium(const hash_digest& value) NOEXCEPT
-  : value_(value)
-{
-}
-
-sodium::operator const hash_digest&() const NOEXCEPT
-{
-    return value_;
-}
-
-sodium::operator bool() const NOEXCEPT
-{
-    return value_ != null_hash;
+    if (!decode(value_, base85))
+        throw istream_exception(base85);
 }
 
 std::string sodium::to_string() const NOEXCEPT
 {
-    std::stringstream value;
+    const auto text = encode(value_);
 
     BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    value << *this;
-    return value.str();
+    return { text.data(), encoded_size };
     BC_POP_WARNING()
 }
 
@@ -69,28 +50,17 @@ std::istream& operator>>(std::istream& input, sodium& argument) THROWS
     std::string base85;
     input >> base85;
 
-    data_chunk out_value;
-    if (!decode_base85(out_value, base85) || out_value.size() != hash_size)
-    {
+    if (!sodium::decode(argument.value_, base85))
         throw istream_exception(base85);
-    }
 
-    std::copy_n(out_value.begin(), hash_size, argument.value_.begin());
     return input;
 }
 
 std::ostream& operator<<(std::ostream& output,
     const sodium& argument) THROWS
 {
-    std::string decoded;
-
-    // Base85 requires four byte alignment (hash_digest is 32).
-    if (!encode_base85(decoded, argument.value_))
-    {
-        throw istream_exception(decoded);
-    }
-
-    output << decoded;
+    const auto text = sodium::encode(argument.value_);
+    output.write(text.data(), sodium::encoded_size);
     return output;
 }
 
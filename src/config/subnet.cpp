@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/config/subnet.hpp>
+
+#include <algorithm>
+#include <array>
+#include <sstream>
+#include <string_view>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/boost.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+
+using namespace bc::system;
+
+// The ipv4 address space is mapped to ::ffff:0:0/96.
+static constexpr uint8_t mapped_prefix = 96;
+static constexpr data_array<12> mapped_header
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+};
+
+static bool is_mapped(const ip_address& address) NOEXCEPT
+{
+    return std::equal(mapped_header.begin(), mapped_header.end(),
+        address.begin());
+}
+
+// Clear all bits beyond the prefix.
+static ip_address mask(const ip_address& address, uint8_t prefix) NOEXCEPT
+{
+    ip_address out{};
+    const auto bytes = prefix / 8u;
+    const auto bits = prefix % 8u;
+    std::copy_n(address.begin(), bytes, out.begin());
+
+    if (!is_zero(bits))
+        out[bytes] = address[bytes] & static_cast<uint8_t>(0xff << (8u - bits));
+
+    return out;
+}
+
+// Parsing is performed from a stack buffer, so does not allocate.
+bool subnet::normalize(ip_address& out, std::string_view host) NOEXCEPT
+{
+    if (host.size() > 1u && host.front() == '[' && host.back() == ']')
+        host = host.substr(one, host.size() - 2u);
+
+    // Longest text form is ipv4-mapped ipv6 with scope (within 64).
+    std::array<char, 64> text{};
+    if (host.size() >= text.size())
+        return false;
+
+    std::copy(host.begin(), host.end(), text.begin());
+
+    boost::system::error_code ec{};
+    const auto value = boost::asio::ip::make_address(text.data(), ec);
+    if (ec)
+        return false;
+
+    const auto bytes = value.is_v4() ?
+        boost::asio::ip::make_address_v6(boost::asio::ip::v4_mapped,
+            value.to_v4()).to_bytes() : value.to_v6().to_bytes();
+
+    std::copy(bytes.begin(), bytes.end(), out.begin());
+    return true;
+}
+
+subnet::subnet() NOEXCEPT
+  : address_{}, prefix_(maximum_prefix)
+{
+}
+
+subnet::subnet(const std::string& cidr) THROWS
+  : subnet()
+{
+    std::stringstream(cidr) >> *this;
+}
+
+subnet::subnet(const ip_address& address, uint8_t prefix) NOEXCEPT
+  : address_(mask(address, std::min(prefix, maximum_prefix))),
+    prefix_(std::min(prefix, maximum_prefix))
+{
+}
+
+const ip_address& subnet::address() const NOEXCEPT
+{
+    return address_;
+}
+
+uint8_t subnet::prefix() const NOEXCEPT
+{
+    return prefix_;
+}
+
+bool subnet::contains(const ip_address& address) const NOEXCEPT
+{
+    return mask(address, prefix_) == address_;
+}
+
+std::string subnet::to_string() const NOEXCEPT
+{
+    std::stringstream value;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    value << *this;
+    return value.str();
+    BC_POP_WARNING()
+}
+
+bool subnet::operator==(const subnet& other) const NOEXCEPT
+{
+    return prefix_ == other.prefix_ && address_ == other.address_;
+}
+
+std::istream& operator>>(std::istream& input, subnet& argument) THROWS
+{
+    std::string cidr;
+    input >> cidr;
+
+    const auto slash = cidr.find('/');
+    const auto host = cidr.substr(zero, slash);
+
+    ip_address address{};
+    if (!subnet::normalize(address, host))
+        throw istream_exception(cidr);
+
+    // An ipv4 host is normalized to mapped ipv6, so offset its prefix.
+    const auto ipv4 = host.find(':') == std::string::npos;
+    const uint32_t maximum = ipv4 ? 32u : subnet::maximum_prefix;
+    auto prefix = maximum;
+
+    if (slash != std::string::npos)
+    {
+        const auto bits = cidr.substr(add1(slash));
+        if (bits.empty() || bits.size() > 3u)
+            throw istream_exception(cidr);
+
+        prefix = 0;
+        for (const auto digit: bits)
+        {
+            if (digit < '0' || digit > '9')
+                throw istream_exception(cidr);
+
+            prefix = prefix * 10u + static_cast<uint32_t>(digit - '0');
+        }
+
+        if (prefix > maximum)
+            throw istream_exception(cidr);
+    }
+
+    argument = subnet{ address, narrow_cast<uint8_t>(ipv4 ?
+        prefix + mapped_prefix : prefix) };
+
+    return input;
+}
+
+std::ostream& operator<<(std::ostream& output, const subnet& argument) THROWS
+{
+    ipv6::bytes_type bytes{};
+    std::copy(argument.address_.begin(), argument.address_.end(),
+        bytes.begin());
+
+    const ipv6 address{ bytes };
+    const auto prefix = static_cast<uint32_t>(argument.prefix_);
+
+    if (is_mapped(argument.address_) && prefix >= mapped_prefix)
+    {
+        output << boost::asio::ip::make_address_v4(boost::asio::ip::v4_mapped,
+            address).to_string() << "/" << (prefix - mapped_prefix);
+    }
+    else
+    {
+        output << address.to_string() << "/" << prefix;
+    }
+
+    return output;
+}
+
+} // namespace protocol
+} // namespace libbitcoin
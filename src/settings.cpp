@@ -33,6 +33,8 @@ settings::settings() NOEXCEPT
     ping_seconds(0),
     inactivity_seconds(0),
     reconnect_seconds(1),
+    reconnect_milliseconds(100),
+    reconnect_jitter(0),
     send_milliseconds(0)
 {
 }
@@ -46,6 +48,8 @@ settings::settings(uint32_t send_high_water,
     ping_seconds(0),
     inactivity_seconds(0),
     reconnect_seconds(1),
+    reconnect_milliseconds(100),
+    reconnect_jitter(0),
     send_milliseconds(0)
 {
 }
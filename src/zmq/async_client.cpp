@@ -0,0 +1,226 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/async_client.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/settings.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/frame.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+async_client::async_client(context& context, size_t capacity,
+    const settings& settings) NOEXCEPT
+  : capacity_(std::max(capacity, one)),
+    dealer_(context, socket::role::dealer, settings),
+    correlation_(0)
+{
+}
+
+async_client::~async_client() NOEXCEPT
+{
+    stop();
+}
+
+async_client::operator bool() const NOEXCEPT
+{
+    return dealer_;
+}
+
+socket& async_client::dealer() NOEXCEPT
+{
+    return dealer_;
+}
+
+error::code async_client::connect(const config::endpoint& address) NOEXCEPT
+{
+    return dealer_.connect(address);
+}
+
+size_t async_client::pending() const NOEXCEPT
+{
+    return requests_.size();
+}
+
+bool async_client::full() const NOEXCEPT
+{
+    return requests_.size() >= capacity_;
+}
+
+bool async_client::stop() NOEXCEPT
+{
+    // Handlers may send, so pending requests are cleared and the socket is
+    // closed before invocation, in which case the send fails immediately.
+    const auto pending = std::move(requests_);
+    requests_.clear();
+    deadlines_.clear();
+    const auto result = dealer_.stop();
+
+    message empty;
+    for (const auto& entry: pending)
+        entry.second.complete(error::context_terminated, empty);
+
+    return result;
+}
+
+// The correlation is unique among requests in flight, as the counter wraps
+// and in-use values are skipped (there is always one free below capacity).
+error::code async_client::send(message& request,
+    uint32_t timeout_milliseconds, handler&& complete) NOEXCEPT
+{
+    if (full())
+        return error::try_again;
+
+    while (requests_.contains(correlation_))
+        ++correlation_;
+
+    const auto correlation = correlation_++;
+    const auto expiry = clock::now() +
+        std::chrono::milliseconds(timeout_milliseconds);
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto inserted = requests_.emplace(correlation, async_client::request
+    {
+        expiry, std::move(complete)
+    });
+    BC_POP_WARNING()
+
+    if (!inserted.second)
+        return error::unknown;
+
+    // The envelope is sent as frames, so that the request is not copied.
+    frame identity{ to_chunk(to_little_endian<uint32_t>(correlation)) };
+    frame delimiter{ data_chunk{} };
+
+    // Nothing is sent if the first part fails.
+    auto ec = identity.send(dealer_, false);
+    if (ec)
+    {
+        requests_.erase(inserted.first);
+        return ec;
+    }
+
+    ec = delimiter.send(dealer_, false);
+    if (!ec) ec = request.send(dealer_);
+
+    // The dealer is within an incomplete multipart message, which cannot be
+    // abandoned, so the socket is closed and all requests are terminated.
+    if (ec)
+    {
+        requests_.erase(inserted.first);
+        stop();
+        return ec;
+    }
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    deadlines_.emplace(expiry, correlation);
+    BC_POP_WARNING()
+    return error::success;
+}
+
+error::code async_client::process(int32_t timeout_milliseconds) NOEXCEPT
+{
+    expire(clock::now());
+
+    poller poller;
+    poller.add(dealer_);
+    auto wait = remaining(timeout_milliseconds);
+
+    // Drain all available replies, waiting only for the first.
+    while (poller.wait(wait).contains(dealer_.id()))
+    {
+        message reply;
+        const auto ec = dealer_.receive(reply);
+        if (ec)
+            return ec;
+
+        complete(reply);
+        wait = 0;
+    }
+
+    expire(clock::now());
+    return poller.terminated() ? error::context_terminated : error::success;
+}
+
+// private
+// Replies to expired or unknown requests are dropped.
+void async_client::complete(message& reply) NOEXCEPT
+{
+    uint32_t correlation;
+    if (!reply.dequeue(correlation) || !reply.front().empty() ||
+        !reply.dequeue())
+        return;
+
+    const auto it = requests_.find(correlation);
+    if (it == requests_.end())
+        return;
+
+    const auto callback = std::move(it->second.complete);
+    deadlines_.erase({ it->second.expiry, correlation });
+    requests_.erase(it);
+    callback(error::success, reply);
+}
+
+// private
+void async_client::expire(const clock::time_point& now) NOEXCEPT
+{
+    message empty;
+    while (!deadlines_.empty() && deadlines_.begin()->first <= now)
+    {
+        const auto it = requests_.find(deadlines_.begin()->second);
+        deadlines_.erase(deadlines_.begin());
+
+        if (it == requests_.end())
+            continue;
+
+        const auto callback = std::move(it->second.complete);
+        requests_.erase(it);
+        callback(error::timed_out, empty);
+    }
+}
+
+// private
+// The poll timeout is limited by the earliest deadline.
+int32_t async_client::remaining(int32_t timeout_milliseconds) const NOEXCEPT
+{
+    if (deadlines_.empty())
+        return timeout_milliseconds;
+
+    const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+        deadlines_.begin()->first - clock::now()).count();
+    const auto until = limit<int32_t>(std::max(left, decltype(left){ 0 }));
+
+    return is_negative(timeout_milliseconds) ? until :
+        std::min(timeout_milliseconds, until);
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
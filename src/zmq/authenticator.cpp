@@ -18,15 +18,31 @@
  */
 #include <bitcoin/protocol/zmq/authenticator.hpp>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/config/sodium.hpp>
+#include <bitcoin/protocol/config/subnet.hpp>
 #include <bitcoin/protocol/define.hpp>
-#include <bitcoin/protocol/zmq/message.hpp>
 #include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/decision_cache.hpp>
+#include <bitcoin/protocol/zmq/frame.hpp>
+#include <bitcoin/protocol/zmq/key_store.hpp>
 #include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/rate_limiter.hpp>
 #include <bitcoin/protocol/zmq/socket.hpp>
 #include <bitcoin/protocol/zmq/worker.hpp>
+#include <bitcoin/protocol/zmq/zap_metrics.hpp>
+#include "probes.hpp"
+
+BCP_PROBE_SEMAPHORE(zap_decision);
 
 namespace libbitcoin {
 namespace protocol {
@@ -38,10 +54,17 @@ using namespace bc::system;
 const config::endpoint authenticator::authentication_point("inproc://zeromq.zap.01");
 
 // There may be only one authenticator per process.
-authenticator::authenticator(thread_priority priority) NOEXCEPT
+authenticator::authenticator(thread_priority priority, size_t threads) NOEXCEPT
   : worker(priority),
+    threads_(std::max(threads, one)),
     context_(false),
-    require_allow_(false)
+    pending_limit_(zero),
+    rate_limit_(0),
+    rate_burst_(0),
+    cache_capacity_(zero),
+    cache_milliseconds_(0),
+    generation_(0),
+    policy_(std::make_shared<const policy>())
 {
 }
 
@@ -83,155 +106,595 @@ bool authenticator::stop() NOEXCEPT
     ///////////////////////////////////////////////////////////////////////////
 }
 
-// The replier will never drop messages.
+// Handler threads share this endpoint, requests are dealt round robin.
+static const config::endpoint handler_point("inproc://zeromq.zap.handlers");
+
+// Buckets retained by each rate limiter (bounds memory under scanning).
+static constexpr size_t rate_limit_capacity = 65536;
+
+static std::string_view to_text(const data_slice& data) NOEXCEPT
+{
+    return { pointer_cast<const char>(data.data()), data.size() };
+}
+
+static data_chunk to_payload(std::string_view text) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    return { text.begin(), text.end() };
+    BC_POP_WARNING()
+}
+
+// Statuses.
+// ----------------------------------------------------------------------------
+
+struct status
+{
+    uint16_t value;
+    std::string_view code;
+    std::string_view text;
+    std::string_view userid;
+};
+
+// Indexed by authenticator::reason.
+static constexpr std::array<status, 15> statuses
+{
+    status{ 200, "200", "OK", "anonymous" },
+    status{ 200, "200", "OK", "unspecified" },
+    status{ 400, "400", "Address not enabled for access.", "" },
+    status{ 400, "400", "NULL mechanism requires domain.", "" },
+    status{ 400, "400", "Incorrect NULL parameterization.", "" },
+    status{ 400, "400", "NULL mechanism not authorized.", "" },
+    status{ 400, "400", "Incorrect CURVE parameterization.", "" },
+    status{ 400, "400", "Invalid public key.", "" },
+    status{ 400, "400", "Public key not authorized.", "" },
+    status{ 400, "400", "Incorrect PLAIN parameterization.", "" },
+    status{ 400, "400", "PLAIN mechanism not supported.", "" },
+    status{ 400, "400", "Security mechanism not supported.", "" },
+    status{ 500, "500", "Internal error.", "" },
+    status{ 300, "300", "Too many pending requests.", "" },
+    status{ 400, "400", "Rate limit exceeded.", "" }
+};
+
+static_assert(statuses.size() ==
+    add1(static_cast<size_t>(authenticator::reason::rate_limited)));
+static_assert(statuses.size() == zap_metrics::reasons);
+
+static void record(zap_metrics& metrics, const socket& router,
+    authenticator::reason cause,
+    const zap_metrics::clock::time_point& start) NOEXCEPT
+{
+    const auto index = static_cast<size_t>(cause);
+    const auto latency = zap_metrics::clock::now() - start;
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    const auto code = statuses[index].value;
+    BC_POP_WARNING()
+
+    metrics.record(index, code, latency);
+    BCP_PROBE(zap_decision, router.id(), index, code,
+        std::chrono::duration_cast<std::chrono::microseconds>(latency)
+            .count());
+}
+
+// Handlers append the reason (index) to each response, as the status text
+// does not distinguish reasons (such as allowed_null and allowed_curve).
+static bool get_reason(authenticator::reason& out,
+    const data_slice& tag) NOEXCEPT
+{
+    if (tag.size() != one || tag.front() >= statuses.size())
+        return false;
+
+    out = static_cast<authenticator::reason>(tag.front());
+    return true;
+}
+
+// Pre-built status frames of one thread, sent by reference (zmq_msg_copy).
+// These are small payloads, so each send copies into the message (no heap).
+class status_frames
+{
+public:
+    status_frames() NOEXCEPT
+    {
+        // Reserved, as frames are not relocated once initialized.
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        codes_.reserve(statuses.size());
+        texts_.reserve(statuses.size());
+        userids_.reserve(statuses.size());
+        reasons_.reserve(statuses.size());
+
+        for (size_t index = 0; index < statuses.size(); ++index)
+        {
+            const auto& status = statuses[index];
+            codes_.emplace_back(to_payload(status.code));
+            texts_.emplace_back(to_payload(status.text));
+            userids_.emplace_back(to_payload(status.userid));
+            reasons_.emplace_back(data_chunk{ narrow_cast<uint8_t>(index) });
+        }
+        BC_POP_WARNING()
+    }
+
+    // A nonempty user id or metadata replaces the default (granted).
+    // A tagged response is followed by the reason (for the frontend only).
+    error::code send(socket& socket, authenticator::reason cause,
+        const data_chunk& user_id, const data_chunk& metadata,
+        bool tagged) NOEXCEPT
+    {
+        const auto index = static_cast<size_t>(cause);
+
+        if (const auto ec = codes_[index].share(socket, false))
+            return ec;
+
+        if (const auto ec = texts_[index].share(socket, false))
+            return ec;
+
+        if (const auto ec = user_id.empty() ?
+            userids_[index].share(socket, false) :
+            frame{ user_id }.send(socket, false))
+            return ec;
+
+        if (const auto ec = metadata.empty() ?
+            empty_.share(socket, !tagged) :
+            frame{ metadata }.send(socket, !tagged))
+            return ec;
+
+        return tagged ? reasons_[index].share(socket, true) : error::success;
+    }
+
+    error::code send_empty(socket& socket) NOEXCEPT
+    {
+        return empty_.share(socket, false);
+    }
+
+private:
+    std::vector<frame> codes_{};
+    std::vector<frame> texts_{};
+    std::vector<frame> userids_{};
+    std::vector<frame> reasons_{};
+    frame empty_{};
+};
+
+// Request frames.
+// ----------------------------------------------------------------------------
+
+// A request is [version][sequence][domain][address][identity][mechanism]
+// [credentials...], routed requests are preceded by [route][delimiter].
+// Frames are received into a fixed set and read as views (not copied), and
+// frames are reused across requests, so a request causes no allocation.
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+class authenticator::zap_request
+{
+public:
+    enum field : size_t
+    {
+        version,
+        sequence,
+        domain,
+        address,
+        identity,
+        mechanism,
+        credentials,
+
+        // Response fields.
+        status_code = domain,
+        status_text = address,
+        user_id = identity,
+        metadata = mechanism,
+        reason_tag = credentials
+    };
+
+    // At most two credentials are defined (PLAIN).
+    static constexpr size_t maximum = 2u + credentials + 2u;
+
+    zap_request(bool routed) NOEXCEPT
+      : offset_(routed ? 2u : zero), size_(zero), overflow_(false)
+    {
+    }
+
+    // Excess frames are received and discarded, and mark the request.
+    error::code receive(socket& socket) NOEXCEPT
+    {
+        size_ = zero;
+        overflow_ = false;
+
+        while (true)
+        {
+            const auto excess = (size_ == maximum);
+            auto& part = excess ? excess_ : frames_[size_];
+            const auto ec = part.receive(socket);
+            if (ec)
+                return ec;
+
+            overflow_ |= excess;
+            size_ += excess ? zero : one;
+
+            if (!part.more())
+                return error::success;
+        }
+    }
+
+    // Send the frames preceding the field, as received (frames are emptied).
+    error::code forward(socket& socket, size_t limit=maximum) NOEXCEPT
+    {
+        const auto size = std::min(size_, offset_ + limit);
+        for (size_t index = 0; index < size; ++index)
+            if (const auto ec = frames_[index].send(socket,
+                index == sub1(size)))
+                return ec;
+
+        return error::success;
+    }
+
+    // Send the envelope, version and sequence, then the status of reason.
+    // Handler (unrouted) responses are tagged with the reason, which is
+    // removed by the frontend before the response is returned to zeromq.
+    error::code respond(socket& socket, status_frames& replies,
+        reason cause, const data_chunk& user_id={},
+        const data_chunk& metadata={}) NOEXCEPT
+    {
+        for (size_t index = 0; index < offset_ + field::domain; ++index)
+        {
+            const auto ec = index < size_ ?
+                frames_[index].send(socket, false) :
+                replies.send_empty(socket);
+
+            if (ec)
+                return ec;
+        }
+
+        return replies.send(socket, cause, user_id, metadata,
+            is_zero(offset_));
+    }
+
+    bool well_formed() const NOEXCEPT
+    {
+        return !overflow_ && size_ >= offset_ + field::credentials;
+    }
+
+    size_t credential_count() const NOEXCEPT
+    {
+        return well_formed() ? size_ - offset_ - field::credentials : zero;
+    }
+
+    data_slice route() const NOEXCEPT
+    {
+        return is_zero(offset_) || is_zero(size_) ? data_slice{} :
+            frames_.front().view();
+    }
+
+    data_slice view(size_t part) const NOEXCEPT
+    {
+        const auto index = offset_ + part;
+        return index < size_ ? frames_[index].view() : data_slice{};
+    }
+
+    std::string_view text(size_t part) const NOEXCEPT
+    {
+        return to_text(view(part));
+    }
+
+private:
+    const size_t offset_;
+    size_t size_;
+    bool overflow_;
+    std::array<frame, maximum> frames_{};
+    frame excess_{};
+};
+BC_POP_WARNING()
+
+// Work.
+// ----------------------------------------------------------------------------
+
+// The router will never drop messages.
 // rfc.zeromq.org/spec:27/ZAP/
 void authenticator::work() NOEXCEPT
 {
-    socket replier(context_, zmq::socket::role::replier);
+    socket router(context_, zmq::socket::role::router);
+    socket dealer(context_, zmq::socket::role::dealer);
 
-    if (!started(replier.bind(authentication_point) == error::success))
+    if (!started(router.bind(authentication_point) == error::success &&
+        dealer.bind(handler_point) == error::success))
         return;
 
+    // Handlers close their sockets upon context termination, allowing stop.
+    std::vector<std::thread> handlers{};
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    for (auto handler = zero; handler < threads_; ++handler)
+        handlers.emplace_back(&authenticator::handle, this);
+    BC_POP_WARNING()
+
     poller poller;
-    poller.add(replier);
+    poller.add(router);
+    poller.add(dealer);
 
-    while (!poller.terminated() && !stopped())
+    // The state of a dispatched request required to process its response.
+    struct dispatched
     {
-        if (!poller.wait().contains(replier.id()))
-            continue;
+        std::string domain;
+        std::string cache;
+        uint64_t generation;
+        zap_metrics::clock::time_point start;
+    };
 
-        std::string version;
-        std::string sequence;
-        std::string status_code;
-        std::string status_text;
-        std::string userid;
-        std::string metadata;
+    // Requests dispatched but not yet answered, by route and by domain.
+    // Routes and typical domains are within small string optimization.
+    std::unordered_map<std::string, dispatched> routes{};
+    std::unordered_map<std::string, size_t, text_hash, std::equal_to<>>
+        pending{};
 
-        message request;
-        const auto ec = replier.receive(request);
+    // Handshake attempts by address and by public key.
+    const auto rate = rate_limit_.load();
+    const auto burst = rate_burst_.load();
+    rate_limiter addresses{ rate, burst, rate_limit_capacity };
+    rate_limiter keys{ rate, burst, rate_limit_capacity };
 
-        if (ec != error::success || request.size() < 6)
-        {
-            status_code = "500";
-            status_text = "Internal error.";
-        }
-        else
+    // Decisions by request, invalidated by policy generation.
+    decision_cache decisions{ cache_capacity_.load(),
+        std::chrono::milliseconds{ cache_milliseconds_.load() } };
+
+    // Frames and buffers are reused across requests.
+    decision_cache::decision decision{};
+    status_frames replies{};
+    zap_request request{ true };
+    zap_request response{ true };
+    std::string address{};
+    std::string key{};
+    std::string cache{};
+
+    while (!poller.terminated() && !stopped())
+    {
+        const auto signaled = poller.wait();
+
+        if (signaled.contains(router.id()) &&
+            request.receive(router) == error::success)
         {
-            version = request.dequeue_text();
-            sequence = request.dequeue_text();
-            const auto domain = request.dequeue_text();
-            const auto address = request.dequeue_text();
-            const auto identity = request.dequeue_text();
-            const auto mechanism = request.dequeue_text();
-
-            if (version != "1.0" || sequence.empty() || !identity.empty())
+            BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+            const auto start = zap_metrics::clock::now();
+            const auto limit = pending_limit_.load();
+            const auto generation = generation_.load();
+            const auto domain = request.text(zap_request::domain);
+            const auto mechanism = request.text(zap_request::mechanism);
+            const auto curve = (mechanism == "CURVE");
+
+            address.assign(request.text(zap_request::address));
+            key.assign(curve ? request.text(zap_request::credentials) : "");
+
+            // Only well-formed NULL and CURVE requests are cached, as other
+            // decisions depend upon more than the key.
+            cache.clear();
+            if (decisions.enabled() && request.well_formed() &&
+                request.text(zap_request::version) == "1.0" &&
+                !request.view(zap_request::sequence).empty() &&
+                request.view(zap_request::identity).empty() &&
+                ((mechanism == "NULL" && is_zero(request.credential_count())) ||
+                (curve && request.credential_count() == one &&
+                    key.size() == hash_size)))
             {
-                status_code = "500";
-                status_text = "Internal error.";
+                cache.append(domain).append(1, '\0').append(address)
+                    .append(1, '\0').append(mechanism).append(1, '\0')
+                    .append(key);
             }
-            else if (!allowed_address(address))
+
+            auto entry = pending.find(domain);
+            if (entry == pending.end())
+                entry = pending.emplace(std::string{ domain }, zero).first;
+
+            auto& count = entry->second;
+
+            // Requests that are malformed, or in excess of the domain limit
+            // or of the address or key rate limit, are not dispatched.
+            auto cause = reason::malformed;
+            auto dispatch = false;
+            auto cached = false;
+            if (!request.well_formed())
+                cause = reason::malformed;
+            else if (!is_zero(limit) && count >= limit)
+                cause = reason::pending_limited;
+            else if (!addresses.admit(address) ||
+                (!key.empty() && !keys.admit(key)))
+                cause = reason::rate_limited;
+            else if (!cache.empty() &&
+                decisions.find(decision, cache, generation))
             {
-                // Address restrictions are independent of mechanisms, but NULL
-                // security requires a nonempty domain for this to be called.
-                status_code = "400";
-                status_text = "Address not enabled for access.";
+                cause = static_cast<reason>(decision.reason);
+                cached = true;
             }
             else
+                dispatch = true;
+
+            if (dispatch)
             {
-                if (mechanism == "NULL")
-                {
-                    // NULL ZAP calls are only made for non-empty domain.
-                    // For PLAIN/CURVE, ZAP calls always made if running.
-                    if (domain.empty())
-                    {
-                        status_code = "400";
-                        status_text = "NULL mechanism requires domain.";
-                    }
-                    else if (request.size() != 0)
-                    {
-                        status_code = "400";
-                        status_text = "Incorrect NULL parameterization.";
-                    }
-                    else if (!allowed_weak(domain))
-                    {
-                        status_code = "400";
-                        status_text = "NULL mechanism not authorized.";
-                    }
-                    else
-                    {
-                        // It is more efficient to use an unsecured context or
-                        // to not start the authenticator, but this works too.
-                        status_code = "200";
-                        status_text = "OK";
-                        userid = "anonymous";
-                    }
-                }
-                else if (mechanism == "CURVE")
+                std::string route{ to_text(request.route()) };
+                dispatched state{ std::string{ domain }, cache, generation,
+                    start };
+
+                if (request.forward(dealer) == error::success)
                 {
-                    if (request.size() != 1)
-                    {
-                        status_code = "400";
-                        status_text = "Incorrect CURVE parameterization.";
-                    }
-                    else
-                    {
-                        hash_digest public_key;
-
-                        if (!request.dequeue(public_key))
-                        {
-                            status_code = "400";
-                            status_text = "Invalid public key.";
-                        }
-                        else if (!allowed_key(public_key))
-                        {
-                            status_code = "400";
-                            status_text = "Public key not authorized.";
-                        }
-                        else
-                        {
-                            status_code = "200";
-                            status_text = "OK";
-                            userid = "unspecified";
-                        }
-                    }
+                    ++count;
+                    routes.insert_or_assign(std::move(route),
+                        std::move(state));
+                    metrics_.set_pending(routes.size());
                 }
-                else if (mechanism == "PLAIN")
+            }
+            else if (cached)
+            {
+                request.respond(router, replies, cause, decision.user_id,
+                    decision.metadata);
+                record(metrics_, router, cause, start);
+            }
+            else
+            {
+                request.respond(router, replies, cause);
+                record(metrics_, router, cause, start);
+            }
+            BC_POP_WARNING()
+        }
+
+        if (signaled.contains(dealer.id()) &&
+            response.receive(dealer) == error::success)
+        {
+            BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+            const auto route = routes.find(std::string{
+                to_text(response.route()) });
+
+            if (route != routes.end())
+            {
+                const auto& state = route->second;
+                --pending[state.domain];
+
+                auto decided = reason::malformed;
+                get_reason(decided, response.view(zap_request::reason_tag));
+                record(metrics_, router, decided, state.start);
+
+                // The generation at dispatch precedes the handler's
+                // snapshot, so a policy change invalidates the entry.
+                if (!state.cache.empty() && decided != reason::malformed)
                 {
-                    if (request.size() != 2)
-                    {
-                        status_code = "400";
-                        status_text = "Incorrect PLAIN parameterization.";
-                    }
-                    else
+                    const auto index = static_cast<size_t>(decided);
+                    const auto user_id = response.text(zap_request::user_id);
+
+                    // The default user id is not retained (not granted).
+                    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+                    const auto granted = (user_id != statuses[index].userid);
+                    BC_POP_WARNING()
+
+                    decisions.insert(state.cache,
                     {
-                        ////userid = request.dequeue_text();
-                        ////const auto password = request.dequeue_text();
-                        status_code = "400";
-                        status_text = "PLAIN mechanism not supported.";
-                    }
-                }
-                else
-                {
-                    status_code = "400";
-                    status_text = "Security mechanism not supported.";
+                        static_cast<uint8_t>(decided),
+                        granted ? to_payload(user_id) : data_chunk{},
+                        response.view(zap_request::metadata).to_chunk()
+                    }, state.generation);
                 }
+
+                routes.erase(route);
+                metrics_.set_pending(routes.size());
             }
+            BC_POP_WARNING()
+
+            // This is returned to the zeromq ZAP dispatcher, not the caller.
+            BC_DEBUG_ONLY(const code ec_ =) response.forward(router,
+                zap_request::reason_tag);
+            BC_ASSERT(ec_ == error::success ||
+                ec_ == error::context_terminated);
         }
+    }
+
+    // Handlers terminate with the context, so stop must be called first.
+    for (auto& handler: handlers)
+        handler.join();
+
+    metrics_.set_pending(zero);
+    finished(router.stop() && dealer.stop());
+}
+
+// Handlers evaluate policy concurrently, the envelope is managed by replier.
+void authenticator::handle() NOEXCEPT
+{
+    socket replier(context_, zmq::socket::role::replier);
+
+    if (replier.connect(handler_point) != error::success)
+        return;
+
+    poller poller;
+    poller.add(replier);
+
+    status_frames replies{};
+    zap_request request{ false };
+
+    while (!poller.terminated() && !stopped())
+    {
+        if (!poller.wait().contains(replier.id()))
+            continue;
 
-        message response;
-        response.enqueue(version);
-        response.enqueue(sequence);
-        response.enqueue(status_code);
-        response.enqueue(status_text);
-        response.enqueue(userid);
-        response.enqueue(metadata);
+        if (request.receive(replier) != error::success)
+            continue;
 
-        // This is returned to the zeromq ZAP dispatcher, not the caller.
-        BC_DEBUG_ONLY(const code ec_ =) replier.send(response);
+        grant_ptr attached{};
+        const auto cause = authorize(request, attached);
+
+        BC_DEBUG_ONLY(const code ec_ =) attached ?
+            request.respond(replier, replies, cause, attached->user_id,
+                attached->metadata) :
+            request.respond(replier, replies, cause);
         BC_ASSERT(ec_ == error::success || ec_ == error::context_terminated);
     }
 
-    finished(replier.stop());
+    replier.stop();
+}
+
+// Authorization.
+// ----------------------------------------------------------------------------
+
+authenticator::reason authenticator::authorize(const zap_request& request,
+    grant_ptr& attached) const NOEXCEPT
+{
+    if (!request.well_formed() ||
+        request.text(zap_request::version) != "1.0" ||
+        request.view(zap_request::sequence).empty() ||
+        !request.view(zap_request::identity).empty())
+        return reason::malformed;
+
+    // A single snapshot is used for the entire decision.
+    const auto current = snapshot();
+    const auto domain = request.text(zap_request::domain);
+    const auto mechanism = request.text(zap_request::mechanism);
+    const auto credentials = request.credential_count();
+
+    // Address restrictions are independent of mechanisms, but NULL
+    // security requires a nonempty domain for this to be called.
+    if (!allowed_address(*current, domain,
+        request.text(zap_request::address)))
+        return reason::address_denied;
+
+    if (mechanism == "NULL")
+    {
+        // NULL ZAP calls are only made for non-empty domain.
+        // For PLAIN/CURVE, ZAP calls always made if running.
+        if (domain.empty())
+            return reason::null_domain_required;
+
+        if (!is_zero(credentials))
+            return reason::null_parameters;
+
+        if (!allowed_weak(*current, domain))
+            return reason::null_denied;
+
+        // It is more efficient to use an unsecured context or
+        // to not start the authenticator, but this works too.
+        return reason::allowed_null;
+    }
+
+    if (mechanism == "CURVE")
+    {
+        if (credentials != one)
+            return reason::curve_parameters;
+
+        const auto key = request.view(zap_request::credentials);
+        if (key.size() != hash_size)
+            return reason::curve_key_invalid;
+
+        hash_digest public_key{};
+        std::copy(key.begin(), key.end(), public_key.begin());
+
+        if (!allowed_key(*current, public_key))
+            return reason::curve_key_denied;
+
+        // The grant shares ownership, so it outlives a policy update.
+        const auto entry = current->grants.find(public_key);
+        if (entry != current->grants.end())
+            attached = entry->second;
+
+        return reason::allowed_curve;
+    }
+
+    if (mechanism == "PLAIN")
+    {
+        if (credentials != two)
+            return reason::plain_parameters;
+
+        return reason::plain_unsupported;
+    }
+
+    return reason::mechanism_unsupported;
 }
 
 // This must be called on the socket thread.
@@ -240,14 +703,10 @@ void authenticator::work() NOEXCEPT
 bool authenticator::apply(socket& socket, const std::string& domain,
     bool secure) NOEXCEPT
 {
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    property_mutex_.lock_shared();
-    const auto& private_key = private_key_;
-    const auto have_public_keys = !keys_.empty();
-    const auto require_domain = !secure && !adresses_.empty();
-    property_mutex_.unlock_shared();
-    ///////////////////////////////////////////////////////////////////////////
+    const auto current = snapshot();
+    const auto& private_key = current->private_key;
+    const auto have_public_keys = current->restrict_keys;
+    const auto require_domain = !secure && !current->addresses.empty();
 
     // A private server key is required if there are public client keys.
     if ((have_public_keys && !private_key) ||
@@ -257,9 +716,13 @@ bool authenticator::apply(socket& socket, const std::string& domain,
     // Weak domain list persists after socket close so don't reuse domains.
     if (require_domain)
     {
-        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-        weak_domains_.emplace(domain);
-        BC_POP_WARNING()
+        update([&](policy& next) NOEXCEPT
+        {
+            BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+            next.weak_domains.emplace(domain);
+            BC_POP_WARNING()
+        });
+
         return socket.set_authentication_domain(domain);
     }
 
@@ -270,96 +733,298 @@ bool authenticator::apply(socket& socket, const std::string& domain,
         socket.set_authentication_domain(domain));
 }
 
+// Transports other than tcp do not leave the host, so are not encrypted.
+bool authenticator::apply(socket& socket, const std::string& domain,
+    bool secure, const config::endpoint& endpoint) NOEXCEPT
+{
+    const auto& scheme = endpoint.scheme();
+
+    if (scheme == "inproc")
+        return true;
+
+    if (scheme != "ipc")
+        return apply(socket, domain, secure);
+
+    // ZAP is only called for the NULL mechanism given a domain.
+    if (domain.empty())
+        return true;
+
+    // Clients of ipc have no address, which is allowed only for the domain.
+    update([&](policy& next) NOEXCEPT
+    {
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        next.weak_domains.emplace(domain);
+        next.local_domains.emplace(domain);
+        BC_POP_WARNING()
+    });
+
+    return socket.set_authentication_domain(domain);
+}
+
 void authenticator::set_private_key(const sodium& private_key) NOEXCEPT
+{
+    update([&](policy& next) NOEXCEPT
+    {
+        next.private_key = private_key;
+    });
+}
+
+void authenticator::set_pending_limit(size_t limit) NOEXCEPT
+{
+    pending_limit_.store(limit);
+}
+
+void authenticator::set_decision_cache(size_t capacity,
+    uint32_t milliseconds) NOEXCEPT
+{
+    cache_capacity_.store(capacity);
+    cache_milliseconds_.store(milliseconds);
+}
+
+zap_metrics::snapshot authenticator::metrics() const NOEXCEPT
+{
+    return metrics_.get();
+}
+
+void authenticator::set_rate_limit(uint32_t per_second, uint32_t burst) NOEXCEPT
+{
+    rate_limit_.store(per_second);
+    rate_burst_.store(burst);
+}
+
+// Policy snapshot.
+// ----------------------------------------------------------------------------
+// Readers obtain an immutable snapshot without locking. Writers serialize on
+// the update mutex, copy the current snapshot, modify and publish the copy.
+
+authenticator::policy_ptr authenticator::snapshot() const NOEXCEPT
+{
+    return std::atomic_load(&policy_);
+}
+
+template <typename Update>
+void authenticator::update(Update&& modify) NOEXCEPT
 {
     ///////////////////////////////////////////////////////////////////////////
     // Critical Section
     BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    std::unique_lock lock(property_mutex_);
+    std::unique_lock lock(update_mutex_);
+    auto next = std::make_shared<policy>(*std::atomic_load(&policy_));
     BC_POP_WARNING()
 
-    private_key_ = private_key;
+    modify(*next);
+    std::atomic_store(&policy_, policy_ptr{ std::move(next) });
+    ++generation_;
     ///////////////////////////////////////////////////////////////////////////
 }
 
-bool authenticator::allowed_address(const std::string& ip_address) const NOEXCEPT
+// Addresses are normalized, so ipv4 and mapped ipv6 clients are equivalent.
+// Clients of ipc have no address, so are allowed only for domains applied to
+// ipc endpoints (otherwise an empty address is not found in the rules).
+bool authenticator::allowed_address(const policy& current,
+    std::string_view domain, std::string_view address) NOEXCEPT
 {
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    std::shared_lock lock(property_mutex_);
+    if (address.empty() && current.local_domains.contains(domain))
+        return true;
 
-    const auto entry = adresses_.find(ip_address);
-    const auto found = entry != adresses_.end();
-    return (require_allow_ && found && entry->second) ||
-        (!require_allow_ && (!found || entry->second));
-    ///////////////////////////////////////////////////////////////////////////
-    BC_POP_WARNING()
+    ip_address normal{};
+    auto allowed = false;
+    const auto found = subnet::normalize(normal, address) &&
+        current.addresses.find(allowed, normal);
+
+    // Any allow rule requires that clients be allowed (whitelist).
+    const auto require_allow = !is_zero(current.addresses.allows());
+    return (require_allow && found && allowed) ||
+        (!require_allow && (!found || allowed));
 }
 
-bool authenticator::allowed_key(const hash_digest& public_key) const NOEXCEPT
+bool authenticator::allowed_key(const policy& current,
+    const hash_digest& public_key) NOEXCEPT
 {
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    std::shared_lock lock(property_mutex_);
+    // The key store is consulted in place, without loading into memory.
+    if (!current.restrict_keys)
+        return true;
 
-    return keys_.empty() || keys_.find(public_key) != keys_.end();
-    ///////////////////////////////////////////////////////////////////////////
-    BC_POP_WARNING()
+    return current.keys.find(public_key) != current.keys.end() ||
+        (current.store && current.store->contains(public_key));
+}
+
+bool authenticator::allowed_weak(const policy& current,
+    std::string_view domain) NOEXCEPT
+{
+    return current.weak_domains.find(domain) != current.weak_domains.end();
 }
 
-bool authenticator::allowed_weak(const std::string& domain) const NOEXCEPT
+// Metadata is encoded as ZMTP properties, each a one byte name size, name,
+// four byte big endian value size and value. Invalid names are skipped.
+authenticator::grant_ptr authenticator::encode(const grant& attached) NOEXCEPT
 {
     BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-        std::shared_lock lock(property_mutex_);
+    grant_frames out{ to_payload(attached.user_id), {} };
 
-    return weak_domains_.find(domain) != weak_domains_.end();
-    ///////////////////////////////////////////////////////////////////////////
+    for (const auto& property: attached.properties)
+    {
+        const auto& name = property.first;
+        const auto& value = property.second;
+        if (name.empty() || name.size() > max_uint8)
+            continue;
+
+        const auto size = to_big_endian<uint32_t>(
+            possible_narrow_cast<uint32_t>(value.size()));
+
+        out.metadata.push_back(narrow_cast<uint8_t>(name.size()));
+        out.metadata.insert(out.metadata.end(), name.begin(), name.end());
+        out.metadata.insert(out.metadata.end(), size.begin(), size.end());
+        out.metadata.insert(out.metadata.end(), value.begin(), value.end());
+    }
+
+    return std::make_shared<const grant_frames>(std::move(out));
     BC_POP_WARNING()
 }
 
 void authenticator::allow(const hash_digest& public_key) NOEXCEPT
 {
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    std::unique_lock lock(property_mutex_);
+    update([&](policy& next) NOEXCEPT
+    {
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        next.keys.emplace(public_key);
+        BC_POP_WARNING()
+        next.restrict_keys = true;
+    });
+}
 
-    keys_.emplace(public_key);
-    ///////////////////////////////////////////////////////////////////////////
-    BC_POP_WARNING()
+void authenticator::allow(const hash_digest& public_key,
+    const grant& attached) NOEXCEPT
+{
+    // Encoded once, so that each response sends the payloads as is.
+    const auto encoded = encode(attached);
+
+    update([&](policy& next) NOEXCEPT
+    {
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        next.keys.emplace(public_key);
+        next.grants.insert_or_assign(public_key, encoded);
+        BC_POP_WARNING()
+        next.restrict_keys = true;
+    });
 }
 
-void authenticator::allow(const config::authority& address) NOEXCEPT
+bool authenticator::set_key_store(const key_store::ptr& store) NOEXCEPT
 {
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    std::unique_lock lock(property_mutex_);
+    // An invalid store would otherwise silently deny all of its keys.
+    if (store && !*store)
+        return false;
 
-    require_allow_ = true;
+    update([&](policy& next) NOEXCEPT
+    {
+        next.store = store;
+        next.restrict_keys |= (store != nullptr);
+    });
 
-    // Due to emplace behavior, first writer wins allow/deny conflict.
-    adresses_.emplace(address.to_host(), true);
-    ///////////////////////////////////////////////////////////////////////////
-    BC_POP_WARNING()
+    return true;
+}
+
+void authenticator::allow(const config::authority& address) NOEXCEPT
+{
+    ip_address normal{};
+    if (subnet::normalize(normal, address.to_host()))
+        allow(subnet{ normal });
 }
 
 void authenticator::deny(const config::authority& address) NOEXCEPT
 {
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    ///////////////////////////////////////////////////////////////////////////
-    // Critical Section
-    std::unique_lock lock(property_mutex_);
+    ip_address normal{};
+    if (subnet::normalize(normal, address.to_host()))
+        deny(subnet{ normal });
+}
 
-    // Denial is effective independent of whitelisting.
-    // Due to emplace behavior, first writer wins allow/deny conflict.
-    adresses_.emplace(address.to_host(), false);
-    ///////////////////////////////////////////////////////////////////////////
+void authenticator::allow(const subnet& range) NOEXCEPT
+{
+    update([&](policy& next) NOEXCEPT
+    {
+        // Due to trie insert behavior, first writer wins allow/deny conflict.
+        next.addresses.insert(range, true);
+    });
+}
+
+void authenticator::deny(const subnet& range) NOEXCEPT
+{
+    update([&](policy& next) NOEXCEPT
+    {
+        // Denial is effective independent of whitelisting.
+        // Due to trie insert behavior, first writer wins allow/deny conflict.
+        next.addresses.insert(range, false);
+    });
+}
+
+void authenticator::remove(const hash_digest& public_key) NOEXCEPT
+{
+    update([&](policy& next) NOEXCEPT
+    {
+        next.keys.erase(public_key);
+        next.grants.erase(public_key);
+    });
+}
+
+void authenticator::remove(const subnet& range) NOEXCEPT
+{
+    update([&](policy& next) NOEXCEPT
+    {
+        next.addresses.erase(range);
+    });
+}
+
+void authenticator::allow(const rules& next) NOEXCEPT
+{
+    exchange({}, next);
+}
+
+void authenticator::remove(const rules& prior) NOEXCEPT
+{
+    exchange(prior, {});
+}
+
+// All changes are published in one snapshot, so no decision observes a
+// partially applied rule set. The policy is copied once per call, so bulk
+// loads are linear in the number of rules.
+void authenticator::exchange(const rules& prior, const rules& next) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::unordered_map<hash_digest, grant_ptr> grants{};
+    for (const auto& entry: next.grants)
+        grants.emplace(entry.first, encode(entry.second));
     BC_POP_WARNING()
+
+    update([&](policy& current) NOEXCEPT
+    {
+        for (const auto& key: prior.keys)
+            current.keys.erase(key);
+
+        for (const auto& entry: prior.grants)
+        {
+            current.keys.erase(entry.first);
+            current.grants.erase(entry.first);
+        }
+
+        for (const auto& rule: prior.subnets)
+            current.addresses.erase(rule.first);
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        for (const auto& key: next.keys)
+            current.keys.insert(key);
+
+        for (const auto& entry: grants)
+        {
+            current.keys.insert(entry.first);
+            current.grants.insert_or_assign(entry.first, entry.second);
+        }
+        BC_POP_WARNING()
+
+        for (const auto& rule: next.subnets)
+            current.addresses.insert(rule.first, rule.second);
+
+        current.restrict_keys |= !next.keys.empty() || !grants.empty();
+    });
 }
 
 } // namespace zmq
@@ -18,6 +18,19 @@
  */
 #include <bitcoin/protocol/zmq/certificate.hpp>
 
+#if !defined(HAVE_MSC)
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+#include <algorithm>
+#include <cerrno>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <utility>
+#include <vector>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/zmq/zeromq.hpp>
 
@@ -47,28 +60,34 @@ certificate::certificate(const sodium& private_key) NOEXCEPT
         private_ = private_key;
 }
 
+// private
+certificate::certificate(const sodium& public_key,
+    const sodium& private_key) NOEXCEPT
+  : public_(public_key), private_(private_key)
+{
+}
+
 bool certificate::derive(sodium& out_public, const sodium& private_key) NOEXCEPT
 {
     if (!private_key)
         return false;
 
-    const auto key = private_key.to_string();
-    std::string public_key(zmq_encoded_key_size, 0);
+    const auto key = sodium::encode(private_key);
+    sodium::z85 public_key{};
 
     if (zmq_curve_public(public_key.data(), key.data()) == zmq_fail)
         return false;
 
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    out_public = sodium(public_key);
-    BC_POP_WARNING()
+    out_public = sodium::from_z85(
+        { public_key.data(), zmq_encoded_key_size });
     return out_public;
 }
 
 // TODO: update settings loader so this isn't necessary.
 // BUGBUG: this limitation weakens security by reducing key space.
-static inline bool ok_setting(const std::string& key) NOEXCEPT
+static inline bool ok_setting(const sodium::z85& key) NOEXCEPT
 {
-    return key.find_first_of('#') == std::string::npos;
+    return std::find(key.begin(), key.end(), '#') == key.end();
 }
 
 bool certificate::create(sodium& out_public, sodium& out_private,
@@ -78,20 +97,19 @@ bool certificate::create(sodium& out_public, sodium& out_private,
     // This ensures that the value can be used in libbitcoin settings files.
     for (auto attempt = zero; attempt < max_uint8; attempt++)
     {
-        std::string public_key(zmq_encoded_key_size, 0);
-        std::string private_key(zmq_encoded_key_size, 0);
+        sodium::z85 public_key{};
+        sodium::z85 private_key{};
 
         // SECURITY: this uses platform random number generation.
         if (zmq_curve_keypair(public_key.data(), private_key.data()) == zmq_fail)
             return false;
 
-        if (!setting || (ok_setting(public_key.data()) &&
-            ok_setting(private_key.data())))
+        if (!setting || (ok_setting(public_key) && ok_setting(private_key)))
         {
-            BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-            out_public = sodium(public_key);
-            out_private = sodium(private_key);
-            BC_POP_WARNING()
+            out_public = sodium::from_z85(
+                { public_key.data(), zmq_encoded_key_size });
+            out_private = sodium::from_z85(
+                { private_key.data(), zmq_encoded_key_size });
             return out_public;
         }
     }
@@ -99,6 +117,196 @@ bool certificate::create(sodium& out_public, sodium& out_private,
     return false;
 }
 
+// Bulk.
+// ----------------------------------------------------------------------------
+
+// Key pairs are independent, so each thread generates a contiguous range.
+certificate::list certificate::generate(size_t count, size_t threads,
+    bool setting) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    if (is_zero(threads))
+        threads = std::max(size_t{ std::thread::hardware_concurrency() }, one);
+
+    threads = std::min(threads, std::max(count, one));
+    std::vector<std::pair<sodium, sodium>> pairs(count);
+    std::atomic<bool> failed{ false };
+    std::vector<std::thread> workers{};
+
+    const auto span = ceilinged_divide(count, threads);
+    for (size_t begin = 0; begin < count; begin += span)
+    {
+        const auto end = std::min(begin + span, count);
+        workers.emplace_back([&, begin, end]() NOEXCEPT
+        {
+            for (auto index = begin; index < end && !failed; ++index)
+            {
+                auto& pair = pairs[index];
+                if (!create(pair.first, pair.second, setting))
+                    failed = true;
+            }
+        });
+    }
+
+    for (auto& worker: workers)
+        worker.join();
+
+    list out{};
+    if (failed)
+        return out;
+
+    out.reserve(count);
+    for (const auto& pair: pairs)
+        out.push_back(certificate{ pair.first, pair.second });
+
+    return out;
+    BC_POP_WARNING()
+}
+
+static constexpr size_t record_size = two * hash_size;
+
+// Private keys are erased from buffers once written or parsed. Stores through
+// a volatile pointer are not elided, unlike those of an unused buffer.
+static void wipe(data_chunk& buffer) NOEXCEPT
+{
+    volatile uint8_t* const data = buffer.data();
+    for (size_t index = 0; index < buffer.size(); ++index)
+    {
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+        data[index] = 0;
+        BC_POP_WARNING()
+    }
+}
+
+// The store is written to a file created with owner access (so private keys
+// are never readable by others) and then renamed over the path.
+static bool write_private(const std::filesystem::path& path,
+    const data_chunk& buffer) NOEXCEPT
+{
+    std::error_code ec{};
+    std::filesystem::remove(path, ec);
+
+#if defined(HAVE_MSC)
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    std::filesystem::permissions(path, std::filesystem::perms::owner_read |
+        std::filesystem::perms::owner_write,
+        std::filesystem::perm_options::replace, ec);
+
+    file.write(pointer_cast<const char>(buffer.data()),
+        possible_narrow_sign_cast<std::streamsize>(buffer.size()));
+    file.flush();
+    file.close();
+    return !ec && !file.fail();
+    BC_POP_WARNING()
+#else
+    // Exclusive creation does not follow an existing file or link.
+    const auto file = ::open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL,
+        S_IRUSR | S_IWUSR);
+
+    if (file == -1)
+        return false;
+
+    auto written = zero;
+    while (written < buffer.size())
+    {
+        const auto result = ::write(file, std::next(buffer.data(), written),
+            buffer.size() - written);
+
+        if (result == -1 && errno == EINTR)
+            continue;
+
+        if (result <= 0)
+            break;
+
+        written += possible_narrow_sign_cast<size_t>(result);
+    }
+
+    const auto synchronized = (::fsync(file) != -1);
+    return (::close(file) != -1) && synchronized &&
+        (written == buffer.size());
+#endif
+}
+
+bool certificate::save(const std::filesystem::path& path,
+    const list& certificates) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    data_chunk buffer{};
+    buffer.reserve(certificates.size() * record_size);
+    for (const auto& certificate: certificates)
+    {
+        const hash_digest& public_key = certificate.public_key();
+        const hash_digest& private_key = certificate.private_key();
+        buffer.insert(buffer.end(), public_key.begin(), public_key.end());
+        buffer.insert(buffer.end(), private_key.begin(), private_key.end());
+    }
+
+    auto temporary = path;
+    temporary += ".tmp";
+    const auto written = write_private(temporary, buffer);
+    wipe(buffer);
+
+    std::error_code ec{};
+    if (written)
+        std::filesystem::rename(temporary, path, ec);
+
+    if (!written || ec)
+    {
+        std::filesystem::remove(temporary, ec);
+        return false;
+    }
+
+    return true;
+    BC_POP_WARNING()
+}
+
+// The file is read in one operation and parsed in place.
+bool certificate::load(list& out, const std::filesystem::path& path) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::error_code ec{};
+    const auto size = std::filesystem::file_size(path, ec);
+    if (ec || !is_zero(size % record_size))
+        return false;
+
+    std::ifstream file(path, std::ios::binary);
+    data_chunk buffer(possible_narrow_cast<size_t>(size));
+    file.read(pointer_cast<char>(buffer.data()),
+        possible_narrow_sign_cast<std::streamsize>(buffer.size()));
+
+    if (file.fail())
+    {
+        wipe(buffer);
+        return false;
+    }
+
+    list certificates{};
+    certificates.reserve(buffer.size() / record_size);
+    for (auto it = buffer.begin(); it != buffer.end(); it += record_size)
+    {
+        hash_digest public_key{};
+        hash_digest private_key{};
+        std::copy_n(it, hash_size, public_key.begin());
+        std::copy_n(std::next(it, hash_size), hash_size, private_key.begin());
+
+        const sodium public_sodium{ public_key };
+        const sodium private_sodium{ private_key };
+        if (!public_sodium || !private_sodium)
+        {
+            wipe(buffer);
+            return false;
+        }
+
+        certificates.push_back(certificate{ public_sodium, private_sodium });
+    }
+
+    wipe(buffer);
+    out = std::move(certificates);
+    return true;
+    BC_POP_WARNING()
+}
+
 certificate::operator bool() const NOEXCEPT
 {
     return public_;
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/decision_cache.hpp>
+
+#include <chrono>
+#include <string>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+decision_cache::decision_cache(size_t capacity,
+    const std::chrono::milliseconds& time_to_live) NOEXCEPT
+  : capacity_(capacity),
+    time_to_live_(time_to_live)
+{
+}
+
+bool decision_cache::enabled() const NOEXCEPT
+{
+    return !is_zero(capacity_) && !is_zero(time_to_live_.count());
+}
+
+size_t decision_cache::size() const NOEXCEPT
+{
+    return entries_.size();
+}
+
+bool decision_cache::find(decision& out, const std::string& key,
+    uint64_t generation, clock::time_point now) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto it = index_.find(key);
+    BC_POP_WARNING()
+
+    if (it == index_.end())
+        return false;
+
+    const auto& item = *it->second;
+    if (item.generation != generation || now >= item.expiry)
+    {
+        entries_.erase(it->second);
+        index_.erase(it);
+        return false;
+    }
+
+    // Move to most recently used.
+    entries_.splice(entries_.begin(), entries_, it->second);
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    out = item.value;
+    BC_POP_WARNING()
+    return true;
+}
+
+void decision_cache::insert(const std::string& key, const decision& value,
+    uint64_t generation, clock::time_point now) NOEXCEPT
+{
+    if (!enabled())
+        return;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto it = index_.find(key);
+    if (it != index_.end())
+    {
+        entries_.erase(it->second);
+        index_.erase(it);
+    }
+    else if (entries_.size() >= capacity_)
+    {
+        index_.erase(entries_.back().key);
+        entries_.pop_back();
+    }
+
+    entries_.push_front({ key, value, generation, now + time_to_live_ });
+    index_.emplace(key, entries_.begin());
+    BC_POP_WARNING()
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
@@ -48,7 +48,10 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { try_again, "non-blocking request but message cannot be sent now" },
     { invalid_message, "invalid message" },
     { interrupted, "operation interrupted by signal before send" },
-    { invalid_socket, "invalid socket" }
+    { invalid_socket, "invalid socket" },
+
+    { sequence_gap, "sequence gap not recoverable" },
+    { timed_out, "request timed out" }
 };
 
 DEFINE_ERROR_T_CATEGORY(error, "protocol", "protocol code")
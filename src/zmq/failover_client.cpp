@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/failover_client.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/settings.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+// The timeout doubles upon each pass through the server list, and the delay
+// before each retry doubles upon each retry, both up to 2^5.
+static constexpr size_t maximum_backoff_exponent = 5;
+
+// The zeromq default reconnect interval, used when not configured.
+static constexpr uint32_t default_retry_delay_milliseconds = 100;
+
+failover_client::failover_client(context& context, const endpoints& servers,
+    int32_t timeout_milliseconds, size_t retries,
+    const settings& settings) NOEXCEPT
+  : context_(context),
+    servers_(servers),
+    timeout_(std::max(timeout_milliseconds, 1)),
+    retries_(retries),
+    settings_(settings),
+    server_(zero),
+    requester_()
+{
+}
+
+failover_client::~failover_client() NOEXCEPT
+{
+    stop();
+}
+
+const config::endpoint& failover_client::server() const NOEXCEPT
+{
+    return servers_[server_];
+}
+
+bool failover_client::stop() NOEXCEPT
+{
+    if (!requester_)
+        return true;
+
+    const auto result = requester_->stop();
+    requester_.reset();
+    return result;
+}
+
+error::code failover_client::request(message& request, message& reply) NOEXCEPT
+{
+    if (servers_.empty())
+        return error::resolve_failed;
+
+    for (size_t retry = 0; retry <= retries_; ++retry)
+    {
+        if (!is_zero(retry))
+            std::this_thread::sleep_for(delay(retry));
+
+        const auto pass = std::min(retry / servers_.size(),
+            maximum_backoff_exponent);
+        const auto timeout = limit<int32_t>(int64_t{ timeout_ } << pass);
+
+        const auto ec = attempt(request, reply, timeout);
+
+        if (ec == error::success)
+        {
+            request.clear();
+            return ec;
+        }
+
+        if (ec == error::context_terminated)
+            return ec;
+
+        fail_over();
+    }
+
+    return error::timed_out;
+}
+
+error::code failover_client::heartbeat() NOEXCEPT
+{
+    if (servers_.empty())
+        return error::resolve_failed;
+
+    message ping;
+    ping.enqueue();
+    message pong;
+    const auto ec = attempt(ping, pong, timeout_);
+
+    if (ec && ec != error::context_terminated)
+        fail_over();
+
+    return ec;
+}
+
+// private
+// The request is copied, as it is retained for retry.
+error::code failover_client::attempt(const message& request, message& reply,
+    int32_t timeout_milliseconds) NOEXCEPT
+{
+    if (!requester_)
+    {
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        requester_ = std::make_shared<socket>(context_,
+            socket::role::requester, settings_);
+        BC_POP_WARNING()
+
+        if (!*requester_)
+            return error::context_terminated;
+
+        const auto ec = requester_->connect(server());
+        if (ec)
+            return ec;
+    }
+
+    auto copy = request;
+    auto ec = requester_->send(copy);
+    if (ec)
+        return ec;
+
+    poller poller;
+    poller.add(*requester_);
+
+    if (!poller.wait(timeout_milliseconds).contains(requester_->id()))
+        return poller.terminated() ? error::context_terminated :
+            error::timed_out;
+
+    return requester_->receive(reply);
+}
+
+// private
+// The delay starts at the configured reconnect interval and doubles upon each
+// retry, so that a failed server list is not hammered in a tight loop.
+std::chrono::milliseconds failover_client::delay(size_t retry) const NOEXCEPT
+{
+    const auto base = is_zero(settings_.reconnect_milliseconds) ?
+        default_retry_delay_milliseconds : settings_.reconnect_milliseconds;
+    const auto exponent = std::min(sub1(retry), maximum_backoff_exponent);
+    return std::chrono::milliseconds(uint64_t{ base } << exponent);
+}
+
+// private
+// A requester without a reply cannot send, so the socket is discarded (lazy
+// pirate). Linger is zero, so the unanswered request is also discarded.
+void failover_client::fail_over() NOEXCEPT
+{
+    stop();
+    server_ = add1(server_) % servers_.size();
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
@@ -20,11 +20,18 @@
 
 #include <cstring>
 #include <iterator>
+#include <string>
+#include <utility>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/define.hpp>
 #include <bitcoin/protocol/zmq/error.hpp>
 #include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/socket_metrics.hpp>
 #include <bitcoin/protocol/zmq/zeromq.hpp>
+#include "probes.hpp"
+
+BCP_PROBE_SEMAPHORE(frame_receive);
+BCP_PROBE_SEMAPHORE(frame_send);
 
 namespace libbitcoin {
 namespace protocol {
@@ -44,6 +51,12 @@ frame::frame(const system::data_chunk& data) NOEXCEPT
 {
 }
 
+// Use for sending without a payload copy.
+frame::frame(system::data_chunk&& data) NOEXCEPT
+  : more_(false), valid_(initialize(std::move(data)))
+{
+}
+
 frame::~frame() NOEXCEPT
 {
     destroy();
@@ -64,6 +77,39 @@ bool frame::initialize(const data_chunk& data) NOEXCEPT
     return true;
 }
 
+// Called by zeromq when the last reference to the payload is released.
+static void release(void*, void* hint) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    delete pointer_cast<data_chunk>(hint);
+    BC_POP_WARNING()
+}
+
+// private
+bool frame::initialize(data_chunk&& data) NOEXCEPT
+{
+    // Small payloads are copied into the message, avoiding allocation.
+    if (data.size() < zmq_minimum_shared_size)
+        return initialize(data);
+
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto chunk = new data_chunk(std::move(data));
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+
+    const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
+
+    if (zmq_msg_init_data(buffer, chunk->data(), chunk->size(), &release,
+        chunk) == zmq_fail)
+    {
+        release(nullptr, chunk);
+        return false;
+    }
+
+    return true;
+}
+
 // private
 bool frame::destroy() NOEXCEPT
 {
@@ -103,6 +149,24 @@ data_chunk frame::payload() const NOEXCEPT
     return { begin, std::next(begin, size) };
 }
 
+data_slice frame::view() const NOEXCEPT
+{
+    const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
+    const auto size = zmq_msg_size(buffer);
+    const auto begin = pointer_cast<const uint8_t>(zmq_msg_data(buffer));
+    return { begin, std::next(begin, size) };
+}
+
+std::string frame::property(const std::string& name) const NOEXCEPT
+{
+    const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
+    const auto value = zmq_msg_gets(buffer, name.c_str());
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    return is_null(value) ? std::string{} : std::string{ value };
+    BC_POP_WARNING()
+}
+
 // Must be called on the socket thread.
 error::code frame::receive(socket& socket) NOEXCEPT
 {
@@ -110,9 +174,21 @@ error::code frame::receive(socket& socket) NOEXCEPT
         return error::invalid_message;
 
     const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
+    const auto metrics = socket.metrics();
+    const auto start = metrics == nullptr ?
+        socket_metrics::clock::time_point{} : socket_metrics::clock::now();
+
     const auto result = zmq_msg_recv(buffer, socket.self(), wait_flag)
         != zmq_fail && set_more(socket);
-    return result ? error::success : error::get_last_error();
+    const auto ec = result ? error::success : error::get_last_error();
+    BCP_PROBE(frame_receive, socket.id(), zmq_msg_size(buffer), more_,
+        ec.value());
+
+    if (metrics != nullptr)
+        metrics->received(zmq_msg_size(buffer), !more_, ec,
+            socket_metrics::clock::now() - start);
+
+    return ec;
 }
 
 // Must be called on the socket thread.
@@ -123,8 +199,63 @@ error::code frame::send(socket& socket, bool last) NOEXCEPT
 
     const int flags = (last ? 0 : ZMQ_SNDMORE) | wait_flag;
     const auto& buffer = pointer_cast<zmq_msg_t>(&message_);
+    const auto metrics = socket.metrics();
+
+    // The size is obtained before send, which empties the message.
+    const auto size = zmq_msg_size(buffer);
+    const auto start = metrics == nullptr ?
+        socket_metrics::clock::time_point{} : socket_metrics::clock::now();
+
     const auto result = zmq_msg_send(buffer, socket.self(), flags) != zmq_fail;
-    return result ? error::success : error::get_last_error();
+    const auto ec = result ? error::success : error::get_last_error();
+    BCP_PROBE(frame_send, socket.id(), size, last, ec.value());
+
+    if (metrics != nullptr)
+        metrics->sent(size, last, ec, socket_metrics::clock::now() - start);
+
+    return ec;
+}
+
+// Must be called on the socket thread.
+error::code frame::share(socket& socket, bool last) NOEXCEPT
+{
+    if (!valid_)
+        return error::invalid_message;
+
+    zmq_msg copy;
+    const auto& buffer = pointer_cast<zmq_msg_t>(&copy);
+    const auto& source = pointer_cast<zmq_msg_t>(&message_);
+
+    if (zmq_msg_init(buffer) == zmq_fail)
+        return error::get_last_error();
+
+    // The copy references the source payload (small payloads are copied).
+    const int flags = (last ? 0 : ZMQ_SNDMORE) | wait_flag;
+    if (zmq_msg_copy(buffer, source) == zmq_fail)
+    {
+        const auto ec = error::get_last_error();
+        zmq_msg_close(buffer);
+        return ec;
+    }
+
+    const auto metrics = socket.metrics();
+    const auto size = zmq_msg_size(buffer);
+    const auto start = metrics == nullptr ?
+        socket_metrics::clock::time_point{} : socket_metrics::clock::now();
+
+    error::code ec{ error::success };
+    if (zmq_msg_send(buffer, socket.self(), flags) == zmq_fail)
+    {
+        ec = error::get_last_error();
+        zmq_msg_close(buffer);
+    }
+
+    BCP_PROBE(frame_send, socket.id(), size, last, ec.value());
+
+    if (metrics != nullptr)
+        metrics->sent(size, last, ec, socket_metrics::clock::now() - start);
+
+    return ec;
 }
 
 } // namespace zmq
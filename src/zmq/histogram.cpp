@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/histogram.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+// Counters are independent, so relaxed ordering is sufficient.
+static constexpr auto relaxed = std::memory_order_relaxed;
+
+// Values below four are exact, above which each octave has four buckets.
+static constexpr size_t sub_bits = 2;
+static constexpr size_t sub_buckets = 4;
+
+size_t histogram::bucket(uint64_t microseconds) NOEXCEPT
+{
+    if (microseconds < sub_buckets)
+        return static_cast<size_t>(microseconds);
+
+    const auto octave = sub1(static_cast<size_t>(
+        std::bit_width(microseconds)));
+    const auto sub = static_cast<size_t>(
+        (microseconds >> (octave - sub_bits)) & sub1(sub_buckets));
+    const auto index = sub_buckets * (octave - sub1(sub_bits)) + sub;
+    return std::min(index, sub1(buckets));
+}
+
+uint64_t histogram::lower_bound(size_t bucket) NOEXCEPT
+{
+    if (bucket < sub_buckets)
+        return bucket;
+
+    const auto octave = bucket / sub_buckets + sub1(sub_bits);
+    const auto sub = static_cast<uint64_t>(bucket % sub_buckets);
+    return (sub_buckets + sub) << (octave - sub_bits);
+}
+
+histogram::histogram() NOEXCEPT
+  : counts_{}, count_(0), sum_(0), maximum_(0)
+{
+}
+
+void histogram::record(const clock::duration& duration) NOEXCEPT
+{
+    const auto value = std::max(std::chrono::duration_cast<
+        std::chrono::microseconds>(duration).count(), int64_t{ 0 });
+    const auto micro = static_cast<uint64_t>(value);
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    counts_[bucket(micro)].fetch_add(1, relaxed);
+    BC_POP_WARNING()
+
+    count_.fetch_add(1, relaxed);
+    sum_.fetch_add(micro, relaxed);
+
+    auto maximum = maximum_.load(relaxed);
+    while (micro > maximum &&
+        !maximum_.compare_exchange_weak(maximum, micro, relaxed));
+}
+
+histogram::snapshot histogram::get() const NOEXCEPT
+{
+    snapshot out{};
+    out.count = count_.load(relaxed);
+    out.sum = sum_.load(relaxed);
+    out.maximum = maximum_.load(relaxed);
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    for (size_t index = 0; index < buckets; ++index)
+        out.counts[index] = counts_[index].load(relaxed);
+    BC_POP_WARNING()
+
+    return out;
+}
+
+uint64_t histogram::snapshot::quantile(double fraction) const NOEXCEPT
+{
+    uint64_t total{};
+    for (const auto value: counts)
+        total += value;
+
+    if (is_zero(total))
+        return 0;
+
+    // The rank of the quantile, at least one (the first recorded value).
+    const auto clamped = std::clamp(fraction, 0.0, 1.0);
+    const auto rank = std::max(static_cast<uint64_t>(
+        std::ceil(clamped * static_cast<double>(total))), uint64_t{ 1 });
+
+    uint64_t seen{};
+    for (size_t index = 0; index < buckets; ++index)
+    {
+        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+        seen += counts[index];
+        BC_POP_WARNING()
+
+        if (seen >= rank)
+            return lower_bound(index);
+    }
+
+    return lower_bound(sub1(buckets));
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/key_store.hpp>
+
+#if defined(HAVE_MSC)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <system_error>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+bool key_store::create(const std::filesystem::path& path,
+    hashes keys) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    // The store is replaced by rename, as a mapped file must not be changed
+    // (a truncated mapping faults, and a rewritten one is read partially).
+    auto temporary = path;
+    temporary += ".tmp";
+
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+    for (const auto& key: keys)
+        file.write(pointer_cast<const char>(key.data()), key.size());
+
+    file.flush();
+    file.close();
+
+    std::error_code ec{};
+    if (!file.fail())
+        std::filesystem::rename(temporary, path, ec);
+
+    if (file.fail() || ec)
+    {
+        std::filesystem::remove(temporary, ec);
+        return false;
+    }
+
+    return true;
+    BC_POP_WARNING()
+}
+
+// A file that is empty or not a multiple of the key size is invalid.
+key_store::key_store(const std::filesystem::path& path) NOEXCEPT
+  : memory_(nullptr), length_(zero)
+{
+#if defined(HAVE_MSC)
+    const auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+
+    LARGE_INTEGER size{};
+    if (GetFileSizeEx(file, &size) && !is_zero(size.QuadPart) &&
+        is_zero(size.QuadPart % hash_size))
+    {
+        const auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY,
+            0, 0, nullptr);
+
+        if (mapping != nullptr)
+        {
+            const auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (view != nullptr)
+            {
+                memory_ = pointer_cast<const uint8_t>(view);
+                length_ = possible_narrow_sign_cast<size_t>(size.QuadPart);
+            }
+
+            // The view retains the mapping.
+            CloseHandle(mapping);
+        }
+    }
+
+    CloseHandle(file);
+#else
+    const auto file = ::open(path.c_str(), O_RDONLY);
+    if (file == -1)
+        return;
+
+    struct stat status{};
+    if (::fstat(file, &status) != -1 && !is_zero(status.st_size) &&
+        is_zero(status.st_size % hash_size))
+    {
+        const auto size = possible_narrow_sign_cast<size_t>(status.st_size);
+        const auto view = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+
+        if (view != MAP_FAILED)
+        {
+            // The keys are validated by a sequential scan, so read ahead.
+            ::madvise(view, size, MADV_SEQUENTIAL);
+            memory_ = pointer_cast<const uint8_t>(view);
+            length_ = size;
+        }
+    }
+
+    // The mapping is retained after close.
+    ::close(file);
+#endif
+
+    // Lookup is by binary search, so keys must be sorted and unique.
+    if (memory_ != nullptr)
+    {
+        const auto begin = pointer_cast<const hash_digest>(memory_);
+        const auto end = std::next(begin, size());
+        if (std::adjacent_find(begin, end, std::greater_equal<>{}) != end)
+            unmap();
+    }
+
+#if !defined(HAVE_MSC)
+    // Lookups are random, so disable read-ahead once validated.
+    if (memory_ != nullptr)
+        ::madvise(const_cast<uint8_t*>(memory_), length_, MADV_RANDOM);
+#endif
+}
+
+key_store::~key_store() NOEXCEPT
+{
+    unmap();
+}
+
+void key_store::unmap() NOEXCEPT
+{
+    if (memory_ == nullptr)
+        return;
+
+#if defined(HAVE_MSC)
+    UnmapViewOfFile(memory_);
+#else
+    ::munmap(const_cast<uint8_t*>(memory_), length_);
+#endif
+
+    memory_ = nullptr;
+    length_ = zero;
+}
+
+key_store::operator bool() const NOEXCEPT
+{
+    return memory_ != nullptr;
+}
+
+size_t key_store::size() const NOEXCEPT
+{
+    return length_ / hash_size;
+}
+
+bool key_store::contains(const hash_digest& public_key) const NOEXCEPT
+{
+    if (memory_ == nullptr)
+        return false;
+
+    const auto begin = pointer_cast<const hash_digest>(memory_);
+    return std::binary_search(begin, std::next(begin, size()), public_key);
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/last_value_cache.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/settings.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+#include <bitcoin/protocol/zmq/worker.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+// Subscription messages received by an extended publisher are prefixed by
+// 0x01 for subscribe and 0x00 for unsubscribe.
+static constexpr uint8_t subscribe_prefix = 0x01;
+
+last_value_cache::last_value_cache(context& context,
+    const config::endpoint& upstream, const config::endpoint& downstream,
+    size_t depth, const settings& settings, thread_priority priority) NOEXCEPT
+  : worker(priority),
+    context_(context),
+    upstream_(upstream),
+    downstream_(downstream),
+    depth_(std::max(depth, one)),
+    settings_(settings)
+{
+}
+
+last_value_cache::~last_value_cache() NOEXCEPT
+{
+    stop();
+}
+
+// Restartable after stop and not started on construct.
+// The cache persists across restarts, as it is not associated with sockets.
+void last_value_cache::work() NOEXCEPT
+{
+    socket subscriber(context_, socket::role::extended_subscriber, settings_);
+    socket publisher(context_, socket::role::extended_publisher, settings_);
+
+    // Subscribe upstream to all topics, independent of downstream interest.
+    message subscribe_all;
+    subscribe_all.enqueue(data_chunk{ subscribe_prefix });
+
+    // Verbose so that subscription to a topic by each subscriber is observed.
+    const auto bound =
+        publisher.set_verbose_subscriptions() &&
+        publisher.bind(downstream_) == error::success &&
+        subscriber.connect(upstream_) == error::success &&
+        subscriber.send(subscribe_all) == error::success;
+
+    if (!started(bound))
+        return;
+
+    poller poller;
+    poller.add(subscriber);
+    poller.add(publisher);
+
+    while (!poller.terminated() && !stopped())
+    {
+        const auto signaled = poller.wait();
+
+        if (signaled.contains(subscriber.id()))
+            cache(subscriber, publisher);
+
+        if (signaled.contains(publisher.id()))
+            replay(publisher);
+    }
+
+    const auto result = subscriber.stop();
+    finished(publisher.stop() && result);
+}
+
+// private
+// Retain a copy of the upstream message and forward it to subscribers.
+void last_value_cache::cache(socket& subscriber, socket& publisher) NOEXCEPT
+{
+    message packet;
+    if (subscriber.receive(packet) != error::success || packet.empty())
+        return;
+
+    // The topic is the first message part, which may be empty.
+    auto entry = topics_.find(packet.front());
+
+    if (entry == topics_.end())
+    {
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        entry = topics_.emplace(packet.front(), ring{ depth_ }).first;
+        BC_POP_WARNING()
+    }
+
+    // The oldest message of the topic is overwritten when the ring is full.
+    entry->second.push_back(packet);
+    publisher.send(packet);
+}
+
+// private
+// Replay retained messages of all topics matched by a new subscription.
+void last_value_cache::replay(socket& publisher) NOEXCEPT
+{
+    message subscription;
+    if (publisher.receive(subscription) != error::success)
+        return;
+
+    const auto filter = subscription.dequeue_data();
+
+    // Unsubscriptions are not relayed, as all topics are always subscribed.
+    if (filter.empty() || filter.front() != subscribe_prefix)
+        return;
+
+    // Topics are ordered, so prefix matches are contiguous from lower bound.
+    const data_chunk prefix{ std::next(filter.begin()), filter.end() };
+
+    for (auto topic = topics_.lower_bound(prefix); topic != topics_.end() &&
+        topic->first.size() >= prefix.size() &&
+        std::equal(prefix.begin(), prefix.end(), topic->first.begin());
+        ++topic)
+    {
+        for (const auto& retained: topic->second)
+        {
+            // Send consumes the message, so a copy is sent.
+            auto packet = retained;
+            if (publisher.send(packet) != error::success)
+                return;
+        }
+    }
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
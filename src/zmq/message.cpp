@@ -19,10 +19,17 @@
 #include <bitcoin/protocol/zmq/message.hpp>
 
 #include <algorithm>
+#include <memory>
 #include <utility>
+#include <vector>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/zmq/error.hpp>
 #include <bitcoin/protocol/zmq/frame.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+#include "probes.hpp"
+
+BCP_PROBE_SEMAPHORE(message_receive);
+BCP_PROBE_SEMAPHORE(message_send);
 
 namespace libbitcoin {
 namespace protocol {
@@ -144,6 +151,12 @@ std::string message::dequeue_text() NOEXCEPT
     return text;
 }
 
+const data_chunk& message::front() const NOEXCEPT
+{
+    static const data_chunk empty{};
+    return queue_.empty() ? empty : queue_.front();
+}
+
 void message::clear() NOEXCEPT
 {
     while (!queue_.empty())
@@ -163,38 +176,86 @@ size_t message::size() const NOEXCEPT
 // Must be called on the socket thread.
 error::code message::send(socket& socket) NOEXCEPT
 {
+    size_t parts{};
+    size_t bytes{};
+    error::code ec{ error::success };
+
     while (!queue_.empty())
     {
-        frame part{ queue_.front() };
+        const auto size = queue_.front().size();
+        frame part{ std::move(queue_.front()) };
         queue_.pop();
-        const auto ec = part.send(socket, queue_.empty());
+        ec = part.send(socket, queue_.empty());
 
         if (ec)
-            return ec;
+            break;
+
+        ++parts;
+        bytes += size;
+    }
+
+    BCP_PROBE(message_send, socket.id(), parts, bytes, ec.value());
+    return ec;
+}
+
+// Must be called on the thread of each socket.
+error::code message::send(const sockets& sockets) NOEXCEPT
+{
+    std::vector<frame::ptr> parts{};
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    parts.reserve(queue_.size());
+    while (!queue_.empty())
+    {
+        parts.push_back(std::make_shared<frame>(std::move(queue_.front())));
+        queue_.pop();
+    }
+    BC_POP_WARNING()
+
+    // Parts are referenced (not copied) by each socket, and are freed upon
+    // the last send (or at return in the case of failure).
+    error::code result{ error::success };
+    for (const auto& socket: sockets)
+    {
+        for (size_t part = 0; part < parts.size(); ++part)
+        {
+            const auto last = (part == sub1(parts.size()));
+            const auto ec = parts[part]->share(socket.get(), last);
+
+            if (ec)
+            {
+                result = ec;
+                break;
+            }
+        }
     }
 
-    return error::success;
+    return result;
 }
 
 // Must be called on the socket thread.
 error::code message::receive(socket& socket) NOEXCEPT
 {
     clear();
+    size_t bytes{};
+    error::code ec{ error::success };
     auto done = false;
 
     while (!done)
     {
         frame frame{};
-        const auto ec = frame.receive(socket);
+        ec = frame.receive(socket);
 
         if (ec)
-            return ec;
+            break;
 
         queue_.push(frame.payload());
+        bytes += queue_.back().size();
         done = !frame.more();
     }
 
-    return error::success;
+    BCP_PROBE(message_receive, socket.id(), queue_.size(), bytes, ec.value());
+    return ec;
 }
 
 } // namespace zmq
@@ -0,0 +1,481 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/metrics_server.hpp>
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/authenticator.hpp>
+#include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/histogram.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/socket_metrics.hpp>
+#include <bitcoin/protocol/zmq/socket_monitor.hpp>
+#include <bitcoin/protocol/zmq/zap_metrics.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+// Names are indexed by socket_monitor::event_type.
+static constexpr std::array<std::string_view, socket_monitor::event_types>
+event_names
+{
+    "connected",
+    "connect_delayed",
+    "connect_retried",
+    "listening",
+    "bind_failed",
+    "accepted",
+    "accept_failed",
+    "closed",
+    "close_failed",
+    "disconnected",
+    "monitor_stopped",
+    "handshake_failed_no_detail",
+    "handshake_succeeded",
+    "handshake_failed_protocol",
+    "handshake_failed_auth",
+    "unknown"
+};
+
+// Names are indexed by authenticator::reason.
+static constexpr std::array<std::string_view, zap_metrics::reasons>
+reason_names
+{
+    "allowed_null",
+    "allowed_curve",
+    "address_denied",
+    "null_domain_required",
+    "null_parameters",
+    "null_denied",
+    "curve_parameters",
+    "curve_key_invalid",
+    "curve_key_denied",
+    "plain_parameters",
+    "plain_unsupported",
+    "mechanism_unsupported",
+    "malformed",
+    "pending_limited",
+    "rate_limited"
+};
+
+// Names are indexed by error::error_t, as messages are not stable labels.
+static constexpr std::array<std::string_view,
+    add1(static_cast<size_t>(error::timed_out))>
+error_names
+{
+    "success",
+    "unknown",
+    "socket_state",
+    "context_terminated",
+    "no_thread",
+    "incompatible_protocol",
+    "host_unreachable",
+    "no_buffer_space",
+    "unsupported_operation",
+    "unsupported_protocol",
+    "network_down",
+    "address_in_use",
+    "resolve_failed",
+    "accept_failed",
+    "in_progress",
+    "try_again",
+    "invalid_message",
+    "interrupted",
+    "invalid_socket",
+    "sequence_gap",
+    "timed_out"
+};
+
+static std::string_view to_error_name(size_t code) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    return code < error_names.size() ? error_names[code] :
+        error_names[error::unknown];
+    BC_POP_WARNING()
+}
+
+// Durations are recorded in microseconds and exported in seconds.
+static std::string to_seconds(uint64_t microseconds) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    auto fraction = std::to_string(microseconds % 1'000'000);
+    fraction.insert(zero, 6 - fraction.size(), '0');
+    return std::to_string(microseconds / 1'000'000) + "." + fraction;
+    BC_POP_WARNING()
+}
+
+// Label values are quoted, so quote, backslash and newline are escaped.
+static std::string to_label(const std::string& name) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::string out{ "source=\"" };
+    for (const auto character: name)
+    {
+        if (character == '\n')
+        {
+            out += "\\n";
+            continue;
+        }
+
+        if (character == '"' || character == '\\')
+            out += '\\';
+
+        out += character;
+    }
+
+    return out + "\"";
+    BC_POP_WARNING()
+}
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+static void family(std::string& out, std::string_view name,
+    std::string_view type, std::string_view help) NOEXCEPT
+{
+    out.append("# HELP ").append(name).append(" ").append(help).append("\n");
+    out.append("# TYPE ").append(name).append(" ").append(type).append("\n");
+}
+
+static void sample(std::string& out, std::string_view name,
+    const std::string& labels, std::string_view value) NOEXCEPT
+{
+    out.append(name).append("{").append(labels).append("} ").append(value)
+        .append("\n");
+}
+
+static void sample(std::string& out, std::string_view name,
+    const std::string& labels, uint64_t value) NOEXCEPT
+{
+    sample(out, name, labels, std::to_string(value));
+}
+
+// Cumulative buckets are exported at each power of two (bucket boundaries).
+// Durations are whole microseconds, so the inclusive (le) bound of the buckets
+// below a boundary is one microsecond less than the boundary.
+static void sample(std::string& out, std::string_view name,
+    const std::string& labels, const histogram::snapshot& values) NOEXCEPT
+{
+    constexpr size_t octave = 4;
+    const auto bucket = std::string{ name } + "_bucket";
+
+    uint64_t total{};
+    for (size_t index = 0; index < histogram::buckets; ++index)
+    {
+        if (!is_zero(index) && is_zero(index % octave))
+            sample(out, bucket, labels + ",le=\"" +
+                to_seconds(sub1(histogram::lower_bound(index))) + "\"", total);
+
+        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+        total += values.counts[index];
+        BC_POP_WARNING()
+    }
+
+    sample(out, bucket, labels + ",le=\"+Inf\"", total);
+    sample(out, std::string{ name } + "_sum", labels, to_seconds(values.sum));
+    sample(out, std::string{ name } + "_count", labels, total);
+}
+
+static std::string to_response(const std::string& body) NOEXCEPT
+{
+    return
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+        "Content-Length: " + std::to_string(body.size()) + "\r\n"
+        "Connection: close\r\n"
+        "\r\n" + body;
+}
+
+BC_POP_WARNING()
+
+metrics_server::metrics_server(context& context,
+    const config::endpoint& endpoint, thread_priority priority) NOEXCEPT
+  : worker(priority),
+    context_(context),
+    endpoint_(endpoint)
+{
+}
+
+metrics_server::~metrics_server() NOEXCEPT
+{
+    stop();
+}
+
+void metrics_server::add(const std::string& name,
+    const socket_metrics::ptr& source) NOEXCEPT
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    std::unique_lock lock(mutex_);
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    sockets_.emplace_back(name, source);
+    BC_POP_WARNING()
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+void metrics_server::add(const std::string& name,
+    const socket_monitor::ptr& source) NOEXCEPT
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    std::unique_lock lock(mutex_);
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    monitors_.emplace_back(name, source);
+    BC_POP_WARNING()
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+void metrics_server::add(const std::string& name,
+    const authenticator::ptr& source) NOEXCEPT
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    std::unique_lock lock(mutex_);
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    authenticators_.emplace_back(name, source);
+    BC_POP_WARNING()
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// Sources are copied under lock, and their snapshots taken without it.
+std::string metrics_server::report() const NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    sources<socket_metrics::ptr> sockets{};
+    sources<socket_monitor::ptr> monitors{};
+    sources<authenticator::ptr> authenticators{};
+    {
+        std::unique_lock lock(mutex_);
+        sockets = sockets_;
+        monitors = monitors_;
+        authenticators = authenticators_;
+    }
+
+    std::vector<std::pair<std::string, socket_metrics::snapshot>> traffic{};
+    for (const auto& [name, source]: sockets)
+        if (source)
+            traffic.emplace_back(to_label(name), source->get());
+
+    std::vector<std::pair<std::string, socket_monitor::snapshot>> events{};
+    for (const auto& [name, source]: monitors)
+        if (source)
+            events.emplace_back(to_label(name), source->metrics());
+
+    std::vector<std::pair<std::string, zap_metrics::snapshot>> decisions{};
+    for (const auto& [name, source]: authenticators)
+        if (source)
+            decisions.emplace_back(to_label(name), source->metrics());
+
+    std::string out{};
+
+    // Socket traffic.
+    // ------------------------------------------------------------------------
+
+    if (!traffic.empty())
+    {
+        family(out, "bc_zmq_messages_sent_total", "counter",
+            "Messages sent.");
+        for (const auto& [labels, value]: traffic)
+            sample(out, "bc_zmq_messages_sent_total", labels,
+                value.messages_sent);
+
+        family(out, "bc_zmq_bytes_sent_total", "counter",
+            "Bytes sent, of all message parts.");
+        for (const auto& [labels, value]: traffic)
+            sample(out, "bc_zmq_bytes_sent_total", labels, value.bytes_sent);
+
+        family(out, "bc_zmq_messages_received_total", "counter",
+            "Messages received.");
+        for (const auto& [labels, value]: traffic)
+            sample(out, "bc_zmq_messages_received_total", labels,
+                value.messages_received);
+
+        family(out, "bc_zmq_bytes_received_total", "counter",
+            "Bytes received, of all message parts.");
+        for (const auto& [labels, value]: traffic)
+            sample(out, "bc_zmq_bytes_received_total", labels,
+                value.bytes_received);
+
+        family(out, "bc_zmq_send_failures_total", "counter",
+            "Failed sends by error.");
+        for (const auto& [labels, value]: traffic)
+        {
+            for (size_t code = 0; code < socket_metrics::errors; ++code)
+            {
+                BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+                const auto count = value.send_failures[code];
+                BC_POP_WARNING()
+
+                if (!is_zero(count))
+                    sample(out, "bc_zmq_send_failures_total", labels +
+                        ",error=\"" + std::string{ to_error_name(code) } +
+                        "\"", count);
+            }
+        }
+
+        family(out, "bc_zmq_receive_failures_total", "counter",
+            "Failed receives.");
+        for (const auto& [labels, value]: traffic)
+            sample(out, "bc_zmq_receive_failures_total", labels,
+                value.receive_failures);
+
+        family(out, "bc_zmq_send_seconds", "histogram",
+            "Send call latency, per message part.");
+        for (const auto& [labels, value]: traffic)
+            sample(out, "bc_zmq_send_seconds", labels, value.send_latency);
+
+        family(out, "bc_zmq_receive_seconds", "histogram",
+            "Receive call latency, per message part.");
+        for (const auto& [labels, value]: traffic)
+            sample(out, "bc_zmq_receive_seconds", labels,
+                value.receive_latency);
+    }
+
+    // Socket events.
+    // ------------------------------------------------------------------------
+
+    if (!events.empty())
+    {
+        family(out, "bc_zmq_socket_events_total", "counter",
+            "Socket events by type.");
+        for (const auto& [labels, value]: events)
+        {
+            for (size_t type = 0; type < socket_monitor::event_types; ++type)
+            {
+                BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+                sample(out, "bc_zmq_socket_events_total", labels +
+                    ",event=\"" + std::string{ event_names[type] } + "\"",
+                    value.events[type]);
+                BC_POP_WARNING()
+            }
+        }
+
+        family(out, "bc_zmq_handshake_seconds", "histogram",
+            "Handshake duration, from connect or accept.");
+        for (const auto& [labels, value]: events)
+            sample(out, "bc_zmq_handshake_seconds", labels, value.handshakes);
+    }
+
+    // ZAP decisions.
+    // ------------------------------------------------------------------------
+
+    if (!decisions.empty())
+    {
+        family(out, "bc_zmq_zap_decisions_total", "counter",
+            "ZAP decisions by reason.");
+        for (const auto& [labels, value]: decisions)
+        {
+            for (size_t cause = 0; cause < zap_metrics::reasons; ++cause)
+            {
+                BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+                sample(out, "bc_zmq_zap_decisions_total", labels +
+                    ",reason=\"" + std::string{ reason_names[cause] } + "\"",
+                    value.decisions[cause]);
+                BC_POP_WARNING()
+            }
+        }
+
+        family(out, "bc_zmq_zap_responses_total", "counter",
+            "ZAP responses by status code.");
+        for (const auto& [labels, value]: decisions)
+        {
+            sample(out, "bc_zmq_zap_responses_total", labels +
+                ",code=\"200\"", value.success);
+            sample(out, "bc_zmq_zap_responses_total", labels +
+                ",code=\"300\"", value.temporary);
+            sample(out, "bc_zmq_zap_responses_total", labels +
+                ",code=\"400\"", value.failure);
+            sample(out, "bc_zmq_zap_responses_total", labels +
+                ",code=\"500\"", value.internal);
+        }
+
+        family(out, "bc_zmq_zap_pending", "gauge",
+            "ZAP requests dispatched and not yet answered.");
+        for (const auto& [labels, value]: decisions)
+            sample(out, "bc_zmq_zap_pending", labels, value.pending);
+
+        family(out, "bc_zmq_zap_seconds", "histogram",
+            "ZAP request latency.");
+        for (const auto& [labels, value]: decisions)
+            sample(out, "bc_zmq_zap_seconds", labels, value.latency);
+    }
+
+    return out;
+    BC_POP_WARNING()
+}
+
+// Work.
+// ----------------------------------------------------------------------------
+
+void metrics_server::work() NOEXCEPT
+{
+    socket server(context_, socket::role::streamer);
+
+    if (!started(server.bind(endpoint_) == error::success))
+        return;
+
+    poller poller;
+    poller.add(server);
+
+    while (!poller.terminated() && !stopped())
+    {
+        if (poller.wait().contains(server.id()))
+            respond(server);
+    }
+
+    finished(server.stop());
+}
+
+// private
+// Any request is answered, upon which the connection is closed. Further parts
+// of the request (if any) are discarded, as they arrive after the close.
+void metrics_server::respond(socket& server) const NOEXCEPT
+{
+    message request;
+    if (server.receive(request) != error::success || request.size() != two)
+        return;
+
+    const auto connection = request.dequeue_data();
+
+    // An empty payload signals a connection or disconnection.
+    if (request.front().empty())
+        return;
+
+    message reply;
+    reply.enqueue(connection);
+    reply.enqueue(to_response(report()));
+
+    message close;
+    close.enqueue(connection);
+    close.enqueue();
+
+    if (server.send(reply) == error::success)
+        server.send(close);
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
@@ -0,0 +1,311 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/policy_watcher.hpp>
+
+#if defined(HAVE_LINUX)
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/config/sodium.hpp>
+#include <bitcoin/protocol/config/subnet.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/authenticator.hpp>
+#include <bitcoin/protocol/zmq/worker.hpp>
+#include <bitcoin/protocol/zmq/zeromq.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+#if defined(HAVE_LINUX)
+// True if any pending event is of the policy file (events are consumed).
+static bool notified(int notifier, const std::string& name) NOEXCEPT
+{
+    auto found = false;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    alignas(inotify_event) data_array<4096> buffer{};
+    ssize_t size{};
+    while ((size = ::read(notifier, buffer.data(), buffer.size())) > 0)
+    {
+        // Each event is a header followed by a null padded name of len bytes.
+        for (size_t offset = 0; offset + sizeof(inotify_event) <=
+            static_cast<size_t>(size);)
+        {
+            inotify_event event{};
+            std::memcpy(&event, std::next(buffer.data(), offset),
+                sizeof(inotify_event));
+
+            offset += sizeof(inotify_event);
+            const std::string_view text{ pointer_cast<const char>(
+                std::next(buffer.data(), offset)), std::min<size_t>(
+                    event.len, static_cast<size_t>(size) - offset) };
+
+            found |= (text.substr(zero, text.find('\0')) == name);
+            offset += event.len;
+        }
+    }
+    BC_POP_WARNING()
+
+    return found;
+}
+#endif
+
+// Subnet characters are all valid Z85, so a subnet of encoded key length
+// would otherwise be taken for a key.
+static bool is_subnet(const std::string& value) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    try
+    {
+        subnet{ value };
+        return true;
+    }
+    catch (...)
+    {
+        return false;
+    }
+    BC_POP_WARNING()
+}
+
+policy_watcher::policy_watcher(authenticator& authenticator,
+    const std::filesystem::path& path, thread_priority priority) NOEXCEPT
+  : worker(priority),
+    authenticator_(authenticator),
+    path_(path),
+    rules_{},
+    content_{},
+    staged_{}
+{
+}
+
+policy_watcher::~policy_watcher() NOEXCEPT
+{
+    stop();
+}
+
+bool policy_watcher::parse(authenticator::rules& out,
+    std::istream& input) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    try
+    {
+        authenticator::rules rules{};
+        std::string line{};
+
+        while (std::getline(input, line))
+        {
+            std::string action{};
+            std::string value{};
+            std::string token{};
+            std::istringstream tokens{ line.substr(zero, line.find('#')) };
+
+            if (!(tokens >> action))
+                continue;
+
+            if (!(tokens >> value))
+                return false;
+
+            const auto allow = (action == "allow");
+            if (!allow && action != "deny")
+                return false;
+
+            // Keys are distinguished from addresses by encoded length, and
+            // a valid subnet of that length is a subnet.
+            if (value.size() != zmq_encoded_key_size || is_subnet(value))
+            {
+                if (tokens >> token)
+                    return false;
+
+                rules.subnets.emplace_back(subnet{ value }, allow);
+                continue;
+            }
+
+            if (!allow)
+                return false;
+
+            // A key may be followed by a user id and name=value properties.
+            const sodium key{ value };
+            const auto& public_key = static_cast<const hash_digest&>(key);
+            authenticator::grant grant{};
+            auto granted = false;
+
+            while (tokens >> token)
+            {
+                const auto separator = token.find('=');
+                if (separator == std::string::npos)
+                {
+                    if (granted)
+                        return false;
+
+                    grant.user_id = token;
+                }
+                else
+                {
+                    if (is_zero(separator))
+                        return false;
+
+                    grant.properties.emplace_back(
+                        token.substr(zero, separator),
+                        token.substr(add1(separator)));
+                }
+
+                granted = true;
+            }
+
+            if (granted)
+                rules.grants.insert_or_assign(public_key, std::move(grant));
+            else
+                rules.keys.insert(public_key);
+        }
+
+        out = std::move(rules);
+        return true;
+    }
+    catch (...)
+    {
+        return false;
+    }
+    BC_POP_WARNING()
+}
+
+// Work.
+// ----------------------------------------------------------------------------
+
+void policy_watcher::work() NOEXCEPT
+{
+    std::string content{};
+    if (!started(read(content) && apply(content)))
+        return;
+
+#if defined(HAVE_LINUX)
+    // The directory is watched, as editors commonly replace the file. Only a
+    // completed write or a rename into place signals a complete file.
+    auto notifier = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    const auto directory = path_.parent_path().empty() ?
+        std::filesystem::path{ "." } : path_.parent_path();
+
+    if (notifier != -1 && inotify_add_watch(notifier, directory.c_str(),
+        IN_CLOSE_WRITE | IN_MOVED_TO) == -1)
+    {
+        ::close(notifier);
+        notifier = -1;
+    }
+#endif
+
+    while (!stopped())
+    {
+#if defined(HAVE_LINUX)
+        if (notifier != -1)
+        {
+            // Wake on directory change or on the stop polling interval.
+            pollfd item{ notifier, POLLIN, 0 };
+            if (::poll(&item, 1, zmq_maximum_safe_wait_milliseconds) > 0 &&
+                notified(notifier, path_.filename().string()) &&
+                read(content))
+                apply(content);
+
+            continue;
+        }
+#endif
+        std::this_thread::sleep_for(std::chrono::milliseconds(
+            zmq_maximum_safe_wait_milliseconds));
+
+        // Without notification a file may be read while being written, so a
+        // change is applied only once unchanged across a polling interval.
+        if (!read(content) || content == content_)
+            continue;
+
+        if (content == staged_)
+            apply(content);
+        else
+            staged_ = std::move(content);
+    }
+
+#if defined(HAVE_LINUX)
+    if (notifier != -1)
+        ::close(notifier);
+#endif
+
+    finished(true);
+}
+
+bool policy_watcher::read(std::string& out) const NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    try
+    {
+        std::ifstream file(path_, std::ios::binary);
+        if (!file.good())
+            return false;
+
+        std::ostringstream content{};
+        content << file.rdbuf();
+        if (file.bad())
+            return false;
+
+        out = content.str();
+        return true;
+    }
+    catch (...)
+    {
+        return false;
+    }
+    BC_POP_WARNING()
+}
+
+// A policy without rules is rejected, as it would remove all restrictions
+// (such as of a truncated file), and an unchanged policy is not reapplied.
+bool policy_watcher::apply(const std::string& content) NOEXCEPT
+{
+    if (content == content_)
+        return true;
+
+    authenticator::rules rules{};
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::istringstream input{ content };
+    if (!parse(rules, input) || (rules.keys.empty() &&
+        rules.grants.empty() && rules.subnets.empty()))
+        return false;
+
+    authenticator_.exchange(rules_, rules);
+    rules_ = std::move(rules);
+    content_ = content;
+    staged_.clear();
+    BC_POP_WARNING()
+    return true;
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
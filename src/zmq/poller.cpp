@@ -18,10 +18,14 @@
  */
 #include <bitcoin/protocol/zmq/poller.hpp>
 
+#include <chrono>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/zmq/identifiers.hpp>
 #include <bitcoin/protocol/zmq/socket.hpp>
 #include <bitcoin/protocol/zmq/zeromq.hpp>
+#include "probes.hpp"
+
+BCP_PROBE_SEMAPHORE(poller_wait);
 
 namespace libbitcoin {
 namespace protocol {
@@ -65,10 +69,18 @@ identifiers poller::wait(int32_t timeout_milliseconds) NOEXCEPT
     const auto size = pollers_.size();
     BC_ASSERT(size <= max_int32);
 
+    using clock = std::chrono::steady_clock;
+    const auto start = BCP_PROBE_ENABLED(poller_wait) ? clock::now() :
+        clock::time_point{};
+
     const auto count = possible_narrow_sign_cast<int32_t>(size);
     const auto& items = pointer_cast<zmq_pollitem_t>(pollers_.data());
     const auto signaled = zmq_poll(items, count, timeout_milliseconds);
 
+    BCP_PROBE(poller_wait, size, timeout_milliseconds, signaled,
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            clock::now() - start).count());
+
     // Either one of the sockets was terminated or a signal intervened.
     if (is_negative(signaled))
     {
@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_PROTOCOL_ZMQ_PROBES_HPP
+#define LIBBITCOIN_PROTOCOL_ZMQ_PROBES_HPP
+
+#include <bitcoin/protocol/define.hpp>
+
+// Static tracepoints (USDT), compiled only when WITH_USDT is defined, such
+// as by --enable-usdt. Otherwise a probe is discarded at compile time and its
+// arguments are not evaluated (but are referenced, precluding warnings).
+// Probes are of the provider "libbitcoin_protocol", with each argument an
+// integer (socket id, size, count, error code or microseconds).
+// bpftrace -e 'usdt:<library>:libbitcoin_protocol:frame_send { ... }'
+//
+// frame_receive   (socket, bytes, more, error)
+// frame_send      (socket, bytes, last, error)
+// message_receive (socket, parts, bytes, error)
+// message_send    (socket, parts, bytes, error)
+// poller_wait     (sockets, timeout, signaled, microseconds)
+// zap_decision    (socket, reason, status, microseconds)
+//
+// Each probe has a semaphore, which a tracer increments while attached. A
+// compiled probe tests its semaphore, so its arguments are evaluated only
+// while traced. BCP_PROBE_ENABLED(name) allows the same test for work done
+// only to obtain an argument (such as reading the clock). Each semaphore is
+// defined by BCP_PROBE_SEMAPHORE(name) at global scope of the one source
+// that fires the probe. This header is internal (not installed).
+
+#if defined(WITH_USDT)
+    #define _SDT_HAS_SEMAPHORES 1
+    #include <sys/sdt.h>
+    #define BCP_PROBE_SEMAPHORE(name) \
+        extern "C" __extension__ volatile unsigned short \
+            libbitcoin_protocol_##name##_semaphore \
+            __attribute__((unused, section(".probes"))) = 0
+    #define BCP_PROBE_ENABLED(name) \
+        (__builtin_expect(libbitcoin_protocol_##name##_semaphore, 0) != 0)
+    #define BCP_PROBE(name, ...) \
+        do { if (BCP_PROBE_ENABLED(name)) \
+            STAP_PROBEV(libbitcoin_protocol, name, __VA_ARGS__); \
+        } while (false)
+#else
+    #define BCP_PROBE_SEMAPHORE(name) static_assert(true)
+    #define BCP_PROBE_ENABLED(name) false
+    #define BCP_PROBE(name, ...) \
+        do { if constexpr (false) { [](auto&&...) NOEXCEPT {}(__VA_ARGS__); } \
+        } while (false)
+#endif
+
+#endif
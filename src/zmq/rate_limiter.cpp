@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/rate_limiter.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+rate_limiter::rate_limiter(uint32_t rate, uint32_t burst,
+    size_t capacity) NOEXCEPT
+  : rate_(static_cast<double>(rate)),
+    burst_(static_cast<double>(std::max(burst, 1u))),
+    capacity_(std::max(capacity, one))
+{
+}
+
+size_t rate_limiter::size() const NOEXCEPT
+{
+    return buckets_.size();
+}
+
+bool rate_limiter::admit(const std::string& key,
+    clock::time_point now) NOEXCEPT
+{
+    if (is_zero(rate_))
+        return true;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto entry = index_.find(key);
+
+    if (entry == index_.end())
+    {
+        // Reuse the least recently used bucket once at capacity.
+        if (buckets_.size() >= capacity_)
+        {
+            index_.erase(buckets_.back().key);
+            buckets_.pop_back();
+        }
+
+        buckets_.push_front({ key, burst_ - 1.0, now });
+        index_.emplace(key, buckets_.begin());
+        return true;
+    }
+
+    // Move to most recently used.
+    buckets_.splice(buckets_.begin(), buckets_, entry->second);
+    BC_POP_WARNING()
+
+    auto& bucket = buckets_.front();
+    const std::chrono::duration<double> elapsed = now - bucket.updated;
+    bucket.tokens = std::min(burst_, bucket.tokens + elapsed.count() * rate_);
+    bucket.updated = now;
+
+    if (bucket.tokens < 1.0)
+        return false;
+
+    bucket.tokens -= 1.0;
+    return true;
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/sequenced_publisher.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/settings.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/frame.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+sequenced_publisher::sequenced_publisher(context& context, size_t retention,
+    const settings& settings) NOEXCEPT
+  : retention_(std::max(retention, one)),
+    publisher_(context, socket::role::publisher, settings),
+    recovery_(context, socket::role::router, settings)
+{
+}
+
+sequenced_publisher::~sequenced_publisher() NOEXCEPT
+{
+    stop();
+}
+
+sequenced_publisher::operator bool() const NOEXCEPT
+{
+    return publisher_ && recovery_;
+}
+
+socket& sequenced_publisher::recovery() NOEXCEPT
+{
+    return recovery_;
+}
+
+bool sequenced_publisher::stop() NOEXCEPT
+{
+    const auto result = publisher_.stop();
+    return recovery_.stop() && result;
+}
+
+error::code sequenced_publisher::bind(const config::endpoint& publisher,
+    const config::endpoint& recovery) NOEXCEPT
+{
+    const auto ec = recovery_.bind(recovery);
+    return ec ? ec : publisher_.bind(publisher);
+}
+
+// PUB drops at high water without failure, retention allows recovery.
+error::code sequenced_publisher::send(message& packet) NOEXCEPT
+{
+    if (packet.empty())
+        return error::invalid_message;
+
+    const auto name = packet.dequeue_data();
+    auto entry = topics_.find(name);
+
+    if (entry == topics_.end())
+    {
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        entry = topics_.emplace(name, topic{ zero, ring{ retention_ } }).first;
+        BC_POP_WARNING()
+    }
+
+    auto& state = entry->second;
+    const auto sequence = ++state.sequence;
+
+    message stamped;
+    stamped.enqueue(name);
+    stamped.enqueue_little_endian<uint64_t>(sequence);
+
+    while (!packet.empty())
+        stamped.enqueue(packet.dequeue_data());
+
+    // The oldest message of the topic is overwritten when the ring is full.
+    state.retained.push_back({ sequence, stamped });
+    return publisher_.send(stamped);
+}
+
+// Malformed requests are dropped, as there is no way to correlate a response.
+error::code sequenced_publisher::retransmit() NOEXCEPT
+{
+    poller poller;
+    poller.add(recovery_);
+
+    while (poller.wait(0).contains(recovery_.id()))
+    {
+        message request;
+        auto ec = recovery_.receive(request);
+        if (ec)
+            return ec;
+
+        message::address route;
+        uint32_t identifier;
+        data_chunk name;
+        uint64_t first;
+        uint64_t last;
+
+        if (!request.dequeue(route) || !request.dequeue(identifier) ||
+            !request.dequeue(name) || !request.dequeue(first) ||
+            !request.dequeue(last) || !request.empty() || first > last)
+            continue;
+
+        ec = respond(route, identifier, name, first, last);
+        if (ec)
+            return ec;
+    }
+
+    return poller.terminated() ? error::context_terminated : error::success;
+}
+
+// private
+// Each response message is preceded by the route for the requester and the
+// identifier of the request, which allows the requester to discard responses
+// to any prior (abandoned) request.
+error::code sequenced_publisher::respond(const message::address& route,
+    uint32_t identifier, const data_chunk& name, uint64_t first,
+    uint64_t last) NOEXCEPT
+{
+    const auto request = to_chunk(to_little_endian<uint32_t>(identifier));
+
+    const auto entry = topics_.find(name);
+
+    if (entry != topics_.end())
+    {
+        for (const auto& retained: entry->second.retained)
+        {
+            if (retained.first < first || retained.first > last)
+                continue;
+
+            frame envelope{ to_chunk(route) };
+            auto ec = envelope.send(recovery_, false);
+            if (ec)
+                return ec;
+
+            frame correlation{ request };
+            ec = correlation.send(recovery_, false);
+            if (ec)
+                return ec;
+
+            // Send consumes the message, so a copy is sent.
+            auto packet = retained.second;
+            ec = packet.send(recovery_);
+            if (ec)
+                return ec;
+        }
+    }
+
+    // Terminate the response, as the requester cannot otherwise know of
+    // messages that are no longer retained.
+    message terminator;
+    terminator.enqueue(route);
+    terminator.enqueue(request);
+    terminator.enqueue(name);
+    return terminator.send(recovery_);
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/sequenced_subscriber.hpp>
+
+#include <utility>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/settings.hpp>
+#include <bitcoin/protocol/zmq/context.hpp>
+#include <bitcoin/protocol/zmq/error.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/socket.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+sequenced_subscriber::sequenced_subscriber(context& context,
+    int32_t timeout_milliseconds, const settings& settings) NOEXCEPT
+  : timeout_(timeout_milliseconds),
+    subscriber_(context, socket::role::subscriber, settings),
+    recovery_(context, socket::role::dealer, settings),
+    request_(0)
+{
+}
+
+sequenced_subscriber::~sequenced_subscriber() NOEXCEPT
+{
+    stop();
+}
+
+sequenced_subscriber::operator bool() const NOEXCEPT
+{
+    return subscriber_ && recovery_;
+}
+
+socket& sequenced_subscriber::subscriber() NOEXCEPT
+{
+    return subscriber_;
+}
+
+bool sequenced_subscriber::stop() NOEXCEPT
+{
+    const auto result = subscriber_.stop();
+    return recovery_.stop() && result;
+}
+
+error::code sequenced_subscriber::connect(const config::endpoint& publisher,
+    const config::endpoint& recovery) NOEXCEPT
+{
+    const auto ec = recovery_.connect(recovery);
+    return ec ? ec : subscriber_.connect(publisher);
+}
+
+error::code sequenced_subscriber::receive(data_chunk& topic,
+    uint64_t& sequence, message& payload) NOEXCEPT
+{
+    while (pending_.empty())
+    {
+        message packet;
+        const auto ec = subscriber_.receive(packet);
+        if (ec)
+            return ec;
+
+        data_chunk name;
+        uint64_t current;
+        if (!packet.dequeue(name) || !packet.dequeue(current))
+            return error::invalid_message;
+
+        // A new topic or a restarted publisher (re)establishes the sequence.
+        // Duplicates (recovered and then received) are dropped.
+        const auto it = delivered_.find(name);
+        const auto established = it != delivered_.end() && current != one;
+
+        if (established && current <= it->second)
+            continue;
+
+        if (established && current > add1(it->second))
+            recover(name, add1(it->second), sub1(current));
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        delivered_[name] = current;
+        pending_.push({ std::move(name), current, std::move(packet), false });
+        BC_POP_WARNING()
+    }
+
+    auto& next = pending_.front();
+    topic = std::move(next.topic);
+    sequence = next.sequence;
+    payload = std::move(next.payload);
+    const auto gap = next.gap;
+    pending_.pop();
+    return gap ? error::sequence_gap : error::success;
+}
+
+// private
+// Recovered messages are queued in order, with a gap entry at the first
+// sequence of any range that could not be recovered within the timeout.
+void sequenced_subscriber::recover(const data_chunk& topic, uint64_t first,
+    uint64_t last) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto identifier = ++request_;
+    message request;
+    request.enqueue_little_endian<uint32_t>(identifier);
+    request.enqueue(topic);
+    request.enqueue_little_endian<uint64_t>(first);
+    request.enqueue_little_endian<uint64_t>(last);
+
+    auto next = first;
+    poller poller;
+    poller.add(recovery_);
+
+    if (recovery_.send(request) == error::success)
+    {
+        while (poller.wait(timeout_).contains(recovery_.id()))
+        {
+            message response;
+            if (recovery_.receive(response) != error::success)
+                break;
+
+            // Discard responses (late) from any other request, including a
+            // prior request of the same topic (abandoned upon timeout).
+            uint32_t correlation;
+            data_chunk name;
+            if (!response.dequeue(correlation) || correlation != identifier ||
+                !response.dequeue(name) || name != topic)
+                continue;
+
+            // The terminator has no sequence.
+            uint64_t sequence;
+            if (response.empty())
+                break;
+
+            if (!response.dequeue(sequence) || sequence < next ||
+                sequence > last)
+                continue;
+
+            // Messages between next and sequence are no longer retained.
+            if (sequence > next)
+                pending_.push({ topic, next, {}, true });
+
+            pending_.push({ topic, sequence, std::move(response), false });
+            next = add1(sequence);
+        }
+    }
+
+    if (next <= last)
+        pending_.push({ topic, next, {}, true });
+    BC_POP_WARNING()
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
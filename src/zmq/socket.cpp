@@ -19,6 +19,7 @@
 #include <bitcoin/protocol/zmq/socket.hpp>
 
 #include <algorithm>
+#include <random>
 #include <bitcoin/system.hpp>
 #include <bitcoin/protocol/config/sodium.hpp>
 #include <bitcoin/protocol/define.hpp>
@@ -28,6 +29,7 @@
 #include <bitcoin/protocol/zmq/error.hpp>
 #include <bitcoin/protocol/zmq/identifiers.hpp>
 #include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/socket_metrics.hpp>
 #include <bitcoin/protocol/zmq/zeromq.hpp>
 
 namespace libbitcoin {
@@ -81,12 +83,33 @@ int32_t socket::to_socket_type(role socket_role) NOEXCEPT
     }
 }
 
+// Randomize the initial reconnect interval of each socket, spreading the
+// reconnection of many sockets (such as upon restart of a common server).
+// Zeromq doubles the interval on each attempt, up to the maximum interval.
+int32_t socket::reconnect_interval(uint32_t milliseconds,
+    uint32_t jitter) NOEXCEPT
+{
+    const auto interval = is_zero(milliseconds) ? zmq_reconnect_interval :
+        limit<int32_t>(milliseconds);
+    const auto spread = (int64_t{ interval } * jitter) / 100;
+
+    if (is_zero(spread))
+        return interval;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    thread_local std::default_random_engine engine{ std::random_device{}() };
+    std::uniform_int_distribution<int64_t> distribution(0, spread);
+    return limit<int32_t>(interval + distribution(engine));
+    BC_POP_WARNING()
+}
+
 // Because self is only set on construct, sockets are not restartable.
 // zmq_term terminates blocking operations but blocks until each socket in the
 // context is explicitly closed. Socket close kills transfers after linger.
 socket::socket(void* zmq_socket) NOEXCEPT
   : self_(zmq_socket),
-    identifier_(reinterpret_cast<identifier>(zmq_socket))
+    identifier_(reinterpret_cast<identifier>(zmq_socket)),
+    metrics_{}
 {
 }
 
@@ -103,9 +126,8 @@ socket::socket(context& context, role socket_role,
     if (self_ == nullptr)
         return;
 
-    // TODO: update authenticator to normalize IP addresses for matching.
-    // Currently this is simplified to string matching and so limited to ipv4.
-    if (/*!set(ZMQ_IPV6, zmq_true) ||*/
+    // The authenticator normalizes ipv4 and ipv6 addresses for matching.
+    if (!set32(ZMQ_IPV6, zmq_true) ||
         !set32(ZMQ_LINGER, zmq_false) ||
         !set32(ZMQ_SNDHWM, limit<int32_t>(settings.send_high_water)) ||
         !set32(ZMQ_RCVHWM, limit<int32_t>(settings.receive_high_water)) ||
@@ -143,9 +165,11 @@ socket::socket(context& context, role socket_role,
     }
 
     const auto reconnect = seconds(settings.reconnect_seconds);
+    const auto interval = reconnect_interval(settings.reconnect_milliseconds,
+        settings.reconnect_jitter);
 
-    // Zero disables, reconnect_interval is hardwired to the default (100ms).
-    if (!set32(ZMQ_RECONNECT_IVL, reconnect == 0 ? -1 : zmq_reconnect_interval) ||
+    // Zero disables, the maximum is ignored by zeromq if less than interval.
+    if (!set32(ZMQ_RECONNECT_IVL, reconnect == 0 ? -1 : interval) ||
         !set32(ZMQ_RECONNECT_IVL_MAX, reconnect))
     {
         stop();
@@ -235,6 +259,13 @@ bool socket::set(int32_t option, const data_chunk& value) NOEXCEPT
         != zmq_fail;
 }
 
+// private
+bool socket::set(int32_t option, const hash_digest& value) NOEXCEPT
+{
+    return zmq_setsockopt(self_, option, value.data(), value.size())
+        != zmq_fail;
+}
+
 // For NULL security, ZAP calls are only made for non-empty domain.
 // For PLAIN/CURVE, calls are always made if ZAP handler is present.
 bool socket::set_authentication_domain(const std::string& domain) NOEXCEPT
@@ -248,23 +279,26 @@ bool socket::set_curve_server() NOEXCEPT
     return set32(ZMQ_CURVE_SERVER, zmq_true);
 }
 
+// Keys are set as 32 bytes binary (zeromq also accepts z85), avoiding encoding.
 // Sets socket's long term server key, must set this on CURVE client sockets.
 bool socket::set_curve_client(const sodium& server_public_key) NOEXCEPT
 {
-    return server_public_key &&
-        set(ZMQ_CURVE_SERVERKEY, server_public_key.to_string());
+    return server_public_key && set(ZMQ_CURVE_SERVERKEY,
+        static_cast<const hash_digest&>(server_public_key));
 }
 
 // Sets socket's long term public key, must set this on CURVE client sockets.
 bool socket::set_public_key(const sodium& key) NOEXCEPT
 {
-    return key && set(ZMQ_CURVE_PUBLICKEY, key.to_string());
+    return key && set(ZMQ_CURVE_PUBLICKEY,
+        static_cast<const hash_digest&>(key));
 }
 
 // You must set this on both CURVE client and server sockets.
 bool socket::set_private_key(const sodium& key) NOEXCEPT
 {
-    return key && set(ZMQ_CURVE_SECRETKEY, key.to_string());
+    return key && set(ZMQ_CURVE_SECRETKEY,
+        static_cast<const hash_digest&>(key));
 }
 
 // Use on client for both set_public_key and set_private_key from a cert.
@@ -272,11 +306,9 @@ bool socket::set_private_key(const sodium& key) NOEXCEPT
 // to generate an arbitrary client certificate for a secure socket.
 bool socket::set_certificate(const certificate& certificate) NOEXCEPT
 {
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
     return certificate &&
-        set_public_key(certificate.public_key().to_string()) &&
-        set_private_key(certificate.private_key().to_string());
-    BC_POP_WARNING()
+        set_public_key(certificate.public_key()) &&
+        set_private_key(certificate.private_key());
 }
 
 bool socket::set_socks_proxy(const config::authority& socks_proxy) NOEXCEPT
@@ -295,6 +327,13 @@ bool socket::set_unsubscription(const data_chunk& filter) NOEXCEPT
     return set(ZMQ_UNSUBSCRIBE, filter);
 }
 
+// By default only new subscriptions are passed upstream by extended
+// publishers, so a repeated subscription is not otherwise observable.
+bool socket::set_verbose_subscriptions() NOEXCEPT
+{
+    return set32(ZMQ_XPUB_VERBOSE, zmq_true);
+}
+
 error::code socket::send(message& packet) NOEXCEPT
 {
     return packet.send(*this);
@@ -305,6 +344,16 @@ error::code socket::receive(message& packet) NOEXCEPT
     return packet.receive(*this);
 }
 
+void socket::set_metrics(const socket_metrics::ptr& metrics) NOEXCEPT
+{
+    metrics_ = metrics;
+}
+
+socket_metrics* socket::metrics() const NOEXCEPT
+{
+    return metrics_.get();
+}
+
 } // namespace zmq
 } // namespace protocol
 } // namespace libbitcoin
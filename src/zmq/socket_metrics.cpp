@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/socket_metrics.hpp>
+
+#include <atomic>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/error.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+// Counters are independent, so relaxed ordering is sufficient.
+static constexpr auto relaxed = std::memory_order_relaxed;
+
+socket_metrics::socket_metrics() NOEXCEPT
+  : messages_sent_(0),
+    bytes_sent_(0),
+    messages_received_(0),
+    bytes_received_(0),
+    send_failures_{},
+    receive_failures_(0),
+    send_latency_{},
+    receive_latency_{}
+{
+}
+
+void socket_metrics::sent(size_t bytes, bool last, const error::code& ec,
+    const clock::duration& latency) NOEXCEPT
+{
+    send_latency_.record(latency);
+
+    if (ec)
+    {
+        const auto value = static_cast<size_t>(ec.value());
+        const auto index = value < errors ? value :
+            static_cast<size_t>(error::unknown);
+
+        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+        send_failures_[index].fetch_add(1, relaxed);
+        BC_POP_WARNING()
+        return;
+    }
+
+    bytes_sent_.fetch_add(bytes, relaxed);
+    if (last)
+        messages_sent_.fetch_add(1, relaxed);
+}
+
+void socket_metrics::received(size_t bytes, bool last, const error::code& ec,
+    const clock::duration& latency) NOEXCEPT
+{
+    receive_latency_.record(latency);
+
+    if (ec)
+    {
+        receive_failures_.fetch_add(1, relaxed);
+        return;
+    }
+
+    bytes_received_.fetch_add(bytes, relaxed);
+    if (last)
+        messages_received_.fetch_add(1, relaxed);
+}
+
+socket_metrics::snapshot socket_metrics::get() const NOEXCEPT
+{
+    snapshot out{};
+    out.messages_sent = messages_sent_.load(relaxed);
+    out.bytes_sent = bytes_sent_.load(relaxed);
+    out.messages_received = messages_received_.load(relaxed);
+    out.bytes_received = bytes_received_.load(relaxed);
+    out.receive_failures = receive_failures_.load(relaxed);
+    out.send_latency = send_latency_.get();
+    out.receive_latency = receive_latency_.get();
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    for (size_t index = 0; index < errors; ++index)
+        out.send_failures[index] = send_failures_[index].load(relaxed);
+    BC_POP_WARNING()
+
+    return out;
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
@@ -0,0 +1,301 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/socket_monitor.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/zmq/message.hpp>
+#include <bitcoin/protocol/zmq/poller.hpp>
+#include <bitcoin/protocol/zmq/zeromq.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+// Event types are indexed by event bit, so the mapping must match zeromq.
+static_assert(ZMQ_EVENT_CONNECTED == (1 << 0));
+static_assert(ZMQ_EVENT_DISCONNECTED == (1 << 9));
+static_assert(ZMQ_EVENT_MONITOR_STOPPED == (1 << 10));
+static_assert(ZMQ_EVENT_HANDSHAKE_FAILED_AUTH == (1 << 14));
+
+// Counters are independent, so relaxed ordering is sufficient.
+static constexpr auto relaxed = std::memory_order_relaxed;
+
+// The first event frame is a 16 bit event and 32 bit value (host order).
+static constexpr size_t event_size = sizeof(uint16_t) + sizeof(uint32_t);
+
+// Bound unmatched connection times, as not every connection handshakes.
+static constexpr size_t maximum_opened = 256;
+
+static std::string to_endpoint(const socket& socket) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    return "inproc://monitor" + std::to_string(socket.id());
+    BC_POP_WARNING()
+}
+
+static bool enable(socket& socket, const std::string& endpoint) NOEXCEPT
+{
+    return zmq_socket_monitor(socket.self(), endpoint.c_str(),
+        ZMQ_EVENT_ALL) != zmq_fail;
+}
+
+static socket_monitor::event_type to_type(uint16_t value) NOEXCEPT
+{
+    constexpr auto unknown = socket_monitor::event_type::unknown;
+
+    if (!std::has_single_bit(value))
+        return unknown;
+
+    const auto bit = std::countr_zero(value);
+    return bit < static_cast<int>(unknown) ?
+        static_cast<socket_monitor::event_type>(bit) : unknown;
+}
+
+static bool is_handshake(socket_monitor::event_type type) NOEXCEPT
+{
+    using type_t = socket_monitor::event_type;
+    return type == type_t::handshake_succeeded ||
+        type == type_t::handshake_failed_no_detail ||
+        type == type_t::handshake_failed_protocol ||
+        type == type_t::handshake_failed_auth;
+}
+
+socket_monitor::socket_monitor(context& context, socket& socket,
+    handler&& notify, size_t retain, thread_priority priority) NOEXCEPT
+  : worker(priority),
+    context_(context),
+    endpoint_(to_endpoint(socket)),
+    registered_(enable(socket, endpoint_)),
+    handler_(std::move(notify)),
+    retain_(retain),
+    events_{},
+    handshakes_{}
+{
+}
+
+socket_monitor::~socket_monitor() NOEXCEPT
+{
+    stop();
+}
+
+bool socket_monitor::pop(event& out) NOEXCEPT
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    std::unique_lock lock(mutex_);
+
+    if (retained_.empty())
+        return false;
+
+    out = std::move(retained_.front());
+    retained_.pop_front();
+    return true;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+socket_monitor::snapshot socket_monitor::metrics() const NOEXCEPT
+{
+    snapshot out{};
+    out.handshakes = handshakes_.get();
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    for (size_t index = 0; index < event_types; ++index)
+        out.events[index] = events_[index].load(relaxed);
+    BC_POP_WARNING()
+
+    return out;
+}
+
+// Work.
+// ----------------------------------------------------------------------------
+
+// The pair is bound by zeromq upon registration, and must be connected by the
+// same context. Events queue on the monitored socket until connected.
+void socket_monitor::work() NOEXCEPT
+{
+    socket monitor(context_, socket::role::pair);
+
+    if (!started(registered_ &&
+        monitor.connect({ endpoint_ }) == error::success))
+        return;
+
+    poller poller;
+    poller.add(monitor);
+
+    while (!poller.terminated() && !stopped())
+    {
+        if (poller.wait().contains(monitor.id()))
+            receive(monitor);
+    }
+
+    finished(monitor.stop());
+}
+
+// private
+void socket_monitor::receive(socket& monitor) NOEXCEPT
+{
+    message packet;
+    if (monitor.receive(packet) != error::success ||
+        packet.size() != two || packet.front().size() != event_size)
+        return;
+
+    const auto header = packet.dequeue_data();
+    uint16_t code{};
+    uint32_t value{};
+    std::memcpy(&code, header.data(), sizeof(code));
+    std::memcpy(&value, std::next(header.data(), sizeof(code)), sizeof(value));
+
+    event observed{};
+    observed.type = to_type(code);
+    observed.value = value;
+    observed.address = packet.dequeue_text();
+    observed.time = clock::now();
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    events_[static_cast<size_t>(observed.type)].fetch_add(1, relaxed);
+    BC_POP_WARNING()
+
+    switch (observed.type)
+    {
+        case event_type::connected:
+        case event_type::accepted:
+            open(observed);
+            break;
+        case event_type::disconnected:
+        case event_type::closed:
+            close(observed);
+            break;
+        default:
+            if (is_handshake(observed.type))
+                handshake(observed);
+            break;
+    }
+
+    if (handler_)
+        handler_(observed);
+
+    retain(observed);
+}
+
+// private
+// Concurrent handshakes on one endpoint are matched in order of connection.
+void socket_monitor::open(const event& observed) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    auto& openings = opened_[observed.address];
+    BC_POP_WARNING()
+
+    if (openings.size() == maximum_opened)
+        openings.pop_front();
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    openings.push_back({ observed.value, observed.time });
+    BC_POP_WARNING()
+}
+
+// private
+// A connection dropped before its handshake (e.g. a port scan or a reconnect
+// to a dead peer) must not be matched to a later handshake on the endpoint.
+// Connection and disconnection events carry the file descriptor, handshake
+// events do not. The endpoint may differ between the events, so all are
+// searched when not found under the event address.
+void socket_monitor::close(const event& observed) NOEXCEPT
+{
+    const auto drop = [&](std::deque<opening>& openings) NOEXCEPT
+    {
+        const auto it = std::find_if(openings.begin(), openings.end(),
+            [&](const opening& item) NOEXCEPT
+            {
+                return item.descriptor == observed.value;
+            });
+
+        if (it == openings.end())
+            return false;
+
+        openings.erase(it);
+        return true;
+    };
+
+    const auto entry = opened_.find(observed.address);
+    if (entry != opened_.end() && drop(entry->second))
+    {
+        if (entry->second.empty())
+            opened_.erase(entry);
+
+        return;
+    }
+
+    for (auto it = opened_.begin(); it != opened_.end(); ++it)
+    {
+        if (drop(it->second))
+        {
+            if (it->second.empty())
+                opened_.erase(it);
+
+            return;
+        }
+    }
+}
+
+// private
+void socket_monitor::handshake(event& observed) NOEXCEPT
+{
+    const auto entry = opened_.find(observed.address);
+    if (entry == opened_.end())
+        return;
+
+    observed.handshake = observed.time - entry->second.front().time;
+    handshakes_.record(observed.handshake);
+
+    entry->second.pop_front();
+    if (entry->second.empty())
+        opened_.erase(entry);
+}
+
+// private
+void socket_monitor::retain(const event& observed) NOEXCEPT
+{
+    if (is_zero(retain_))
+        return;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Critical Section
+    std::unique_lock lock(mutex_);
+
+    if (retained_.size() == retain_)
+        retained_.pop_front();
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    retained_.push_back(observed);
+    BC_POP_WARNING()
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/subnet_trie.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/config/subnet.hpp>
+#include <bitcoin/protocol/define.hpp>
+#include <bitcoin/protocol/network.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+// Bits are taken from the most significant bit of the first byte.
+static constexpr size_t bit(const ip_address& address, size_t index) NOEXCEPT
+{
+    return (address[index / 8u] >> (7u - (index % 8u))) & 1u;
+}
+
+// The number of leading bits common to both addresses, up to limit.
+size_t subnet_trie::common(const ip_address& left, const ip_address& right,
+    size_t limit) NOEXCEPT
+{
+    size_t bits = 0;
+    for (size_t byte = 0; byte < left.size() && bits < limit; ++byte)
+    {
+        const auto difference = narrow_cast<uint8_t>(left[byte] ^ right[byte]);
+        if (!is_zero(difference))
+        {
+            bits += std::countl_zero(difference);
+            break;
+        }
+
+        bits += 8u;
+    }
+
+    return std::min(bits, limit);
+}
+
+subnet_trie::subnet_trie() NOEXCEPT
+  : nodes_(one), free_(), size_(zero), allows_(zero)
+{
+}
+
+size_t subnet_trie::size() const NOEXCEPT
+{
+    return size_;
+}
+
+bool subnet_trie::empty() const NOEXCEPT
+{
+    return is_zero(size_);
+}
+
+size_t subnet_trie::allows() const NOEXCEPT
+{
+    return allows_;
+}
+
+size_t subnet_trie::nodes() const NOEXCEPT
+{
+    return nodes_.size() - free_.size();
+}
+
+uint32_t subnet_trie::allocate(const ip_address& address,
+    size_t prefix) NOEXCEPT
+{
+    const node value{ address, {}, narrow_cast<uint8_t>(prefix), rule::none };
+
+    if (!free_.empty())
+    {
+        const auto index = free_.back();
+        free_.pop_back();
+        nodes_[index] = value;
+        return index;
+    }
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    nodes_.push_back(value);
+    BC_POP_WARNING()
+    return possible_narrow_cast<uint32_t>(sub1(nodes_.size()));
+}
+
+void subnet_trie::release(uint32_t index) NOEXCEPT
+{
+    nodes_[index] = {};
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    free_.push_back(index);
+    BC_POP_WARNING()
+}
+
+bool subnet_trie::insert(const subnet& range, bool allow) NOEXCEPT
+{
+    const auto& address = range.address();
+    const size_t prefix = range.prefix();
+    uint32_t current = 0;
+
+    // Descend while the child prefix is within (and matches) the subnet.
+    while (nodes_[current].prefix < prefix)
+    {
+        const auto side = bit(address, nodes_[current].prefix);
+        const auto child = nodes_[current].children[side];
+
+        if (is_zero(child))
+        {
+            const auto leaf = allocate(address, prefix);
+            nodes_[current].children[side] = leaf;
+            current = leaf;
+            break;
+        }
+
+        const auto& next = nodes_[child];
+        const auto shared = common(next.address, address,
+            std::min<size_t>(next.prefix, prefix));
+
+        if (shared == next.prefix)
+        {
+            current = child;
+            continue;
+        }
+
+        // The subnet diverges from (or ends within) the child's path, so
+        // split the path at the divergence (or at the subnet).
+        const auto branch = allocate(address, shared);
+        nodes_[branch].children[bit(nodes_[child].address, shared)] = child;
+        nodes_[current].children[side] = branch;
+        current = branch;
+
+        if (shared < prefix)
+        {
+            const auto leaf = allocate(address, prefix);
+            nodes_[branch].children[bit(address, shared)] = leaf;
+            current = leaf;
+        }
+
+        break;
+    }
+
+    // First writer wins allow/deny conflict (consistent with emplace).
+    auto& value = nodes_[current].value;
+    if (value != rule::none)
+        return false;
+
+    value = allow ? rule::allow : rule::deny;
+    allows_ += allow ? one : zero;
+    ++size_;
+    return true;
+}
+
+bool subnet_trie::erase(const subnet& range) NOEXCEPT
+{
+    const auto& address = range.address();
+    const size_t prefix = range.prefix();
+    uint32_t parent = 0;
+    uint32_t current = 0;
+    uint32_t grandparent = 0;
+
+    while (nodes_[current].prefix < prefix)
+    {
+        const auto child = nodes_[current].children[
+            bit(address, nodes_[current].prefix)];
+
+        if (is_zero(child) || nodes_[child].prefix > prefix ||
+            common(nodes_[child].address, address, nodes_[child].prefix) !=
+                nodes_[child].prefix)
+            return false;
+
+        grandparent = parent;
+        parent = current;
+        current = child;
+    }
+
+    auto& value = nodes_[current].value;
+    if (value == rule::none)
+        return false;
+
+    allows_ -= (value == rule::allow) ? one : zero;
+    value = rule::none;
+    --size_;
+
+    // The root is retained, other nodes are retained only as rule or branch.
+    if (is_zero(current))
+        return true;
+
+    const auto replace = [&](uint32_t above, uint32_t from, uint32_t to)
+        NOEXCEPT
+    {
+        auto& children = nodes_[above].children;
+        children[children[0] == from ? 0 : 1] = to;
+    };
+
+    const auto& children = nodes_[current].children;
+    if (!is_zero(children[0]) && !is_zero(children[1]))
+        return true;
+
+    // A node with one child is replaced by the child.
+    const auto only = is_zero(children[0]) ? children[1] : children[0];
+    replace(parent, current, only);
+    release(current);
+
+    // A leaf removal may leave its (non-root) parent a branch of one.
+    if (is_zero(only) && !is_zero(parent) &&
+        nodes_[parent].value == rule::none)
+    {
+        const auto& siblings = nodes_[parent].children;
+        const auto other = is_zero(siblings[0]) ? siblings[1] : siblings[0];
+        replace(grandparent, parent, other);
+        release(parent);
+    }
+
+    return true;
+}
+
+bool subnet_trie::find(bool& allow, const ip_address& address) const NOEXCEPT
+{
+    auto found = false;
+    uint32_t current = 0;
+
+    while (true)
+    {
+        const auto& next = nodes_[current];
+        if (next.value != rule::none)
+        {
+            found = true;
+            allow = (next.value == rule::allow);
+        }
+
+        if (next.prefix == subnet::maximum_prefix)
+            break;
+
+        current = next.children[bit(address, next.prefix)];
+        if (is_zero(current) || common(nodes_[current].address, address,
+            nodes_[current].prefix) != nodes_[current].prefix)
+            break;
+    }
+
+    return found;
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
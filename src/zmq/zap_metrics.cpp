@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/protocol/zmq/zap_metrics.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <bitcoin/system.hpp>
+#include <bitcoin/protocol/define.hpp>
+
+namespace libbitcoin {
+namespace protocol {
+namespace zmq {
+
+using namespace bc::system;
+
+// Counters are independent, so relaxed ordering is sufficient.
+static constexpr auto relaxed = std::memory_order_relaxed;
+
+zap_metrics::zap_metrics() NOEXCEPT
+  : success_(0), temporary_(0), failure_(0), internal_(0), decisions_{},
+    latency_(), pending_(0)
+{
+}
+
+void zap_metrics::record(size_t reason, uint16_t code,
+    const clock::duration& latency) NOEXCEPT
+{
+    switch (code)
+    {
+        case 200:
+            success_.fetch_add(1, relaxed);
+            break;
+        case 300:
+            temporary_.fetch_add(1, relaxed);
+            break;
+        case 400:
+            failure_.fetch_add(1, relaxed);
+            break;
+        default:
+            internal_.fetch_add(1, relaxed);
+            break;
+    }
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    if (reason < reasons)
+        decisions_[reason].fetch_add(1, relaxed);
+    BC_POP_WARNING()
+
+    latency_.record(latency);
+}
+
+void zap_metrics::set_pending(size_t depth) NOEXCEPT
+{
+    pending_.store(depth, relaxed);
+}
+
+zap_metrics::snapshot zap_metrics::get() const NOEXCEPT
+{
+    snapshot out{};
+    out.success = success_.load(relaxed);
+    out.temporary = temporary_.load(relaxed);
+    out.failure = failure_.load(relaxed);
+    out.internal = internal_.load(relaxed);
+    out.pending = pending_.load(relaxed);
+    out.latency = latency_.get();
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    for (size_t index = 0; index < reasons; ++index)
+        out.decisions[index] = decisions_[index].load(relaxed);
+    BC_POP_WARNING()
+
+    return out;
+}
+
+} // namespace zmq
+} // namespace protocol
+} // namespace libbitcoin
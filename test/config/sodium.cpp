@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::protocol;
+
+BOOST_AUTO_TEST_SUITE(sodium_tests)
+
+#define PRIVATE_KEY "JTKVSB%%)wK0E.X)V>+}o?pNmC{O&4W4b!Ni{Lh6"
+#define PUBLIC_KEY "rq:rM>}U?@Lns47E1%kR.o@n%FcmmsL/@{H8]yf7"
+
+BOOST_AUTO_TEST_CASE(sodium__from_z85__compile_time__valid)
+{
+    static_assert(sodium::from_z85(PUBLIC_KEY));
+    static_assert(!sodium::from_z85("invalid"));
+    BOOST_REQUIRE_EQUAL(sodium::from_z85(PUBLIC_KEY).to_string(), PUBLIC_KEY);
+}
+
+BOOST_AUTO_TEST_CASE(sodium__decode__wrong_size__false_unchanged)
+{
+    bc::system::hash_digest out{ 42 };
+    BOOST_REQUIRE(!sodium::decode(out, "rq:rM"));
+    BOOST_REQUIRE_EQUAL(out[0], 42u);
+}
+
+BOOST_AUTO_TEST_CASE(sodium__decode__invalid_character__false)
+{
+    bc::system::hash_digest out{};
+    BOOST_REQUIRE(!sodium::decode(out,
+        "rq:rM>}U?@Lns47E1%kR.o@n%FcmmsL/@{H8]yf\""));
+}
+
+BOOST_AUTO_TEST_CASE(sodium__decode__word_overflow__false)
+{
+    bc::system::hash_digest out{};
+    BOOST_REQUIRE(!sodium::decode(out,
+        "#####>}U?@Lns47E1%kR.o@n%FcmmsL/@{H8]yf7"));
+}
+
+BOOST_AUTO_TEST_CASE(sodium__encode__decoded__round_trip)
+{
+    bc::system::hash_digest value{};
+    BOOST_REQUIRE(sodium::decode(value, PRIVATE_KEY));
+
+    const auto text = sodium::encode(value);
+    BOOST_REQUIRE_EQUAL(std::string(text.data()), PRIVATE_KEY);
+}
+
+BOOST_AUTO_TEST_CASE(sodium__construct__string__expected)
+{
+    const sodium instance{ std::string{ PRIVATE_KEY } };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE_EQUAL(instance.to_string(), PRIVATE_KEY);
+    BOOST_REQUIRE_THROW(sodium{ std::string{ "invalid" } },
+        bc::system::istream_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../utility.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol;
+using role = zmq::socket::role;
+
+BOOST_AUTO_TEST_SUITE(async_client_tests)
+
+#define TEST_SERVER_ENDPOINT "inproc://server"
+
+BOOST_AUTO_TEST_CASE(async_client__constructor__started_context__valid_empty)
+{
+    zmq::context context;
+    const settings configuration;
+    const zmq::async_client instance(context, 1, configuration);
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE_EQUAL(instance.pending(), 0u);
+    BOOST_REQUIRE(!instance.full());
+}
+
+BOOST_AUTO_TEST_CASE(async_client__send__full__try_again)
+{
+    zmq::context context;
+    const settings configuration;
+    zmq::async_client instance(context, 1, configuration);
+    REQUIRE_SUCCESS(instance.connect({ TEST_SERVER_ENDPOINT }));
+
+    zmq::message request1;
+    request1.enqueue(TEST_MESSAGE);
+    REQUIRE_SUCCESS(instance.send(request1, 1000, [](auto, auto&) {}));
+    BOOST_REQUIRE(instance.full());
+
+    zmq::message request2;
+    request2.enqueue(TEST_MESSAGE);
+    BOOST_REQUIRE_EQUAL(instance.send(request2, 1000, [](auto, auto&) {}),
+        zmq::error::try_again);
+    BOOST_REQUIRE_EQUAL(instance.pending(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(async_client__send__no_peer__try_again_not_retained)
+{
+    zmq::context context;
+    settings configuration;
+    configuration.send_milliseconds = 1;
+    zmq::async_client instance(context, 1, configuration);
+
+    // Nothing is sent, so the client remains usable.
+    zmq::message request;
+    request.enqueue(TEST_MESSAGE);
+    auto invoked = false;
+    BOOST_REQUIRE_EQUAL(instance.send(request, 1000, [&](auto, auto&)
+    {
+        invoked = true;
+    }), zmq::error::try_again);
+    BOOST_REQUIRE_EQUAL(instance.pending(), 0u);
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.stop());
+    BOOST_REQUIRE(!invoked);
+}
+
+BOOST_AUTO_TEST_CASE(async_client__stop__handler_resends__send_failed)
+{
+    zmq::context context;
+    const settings configuration;
+    zmq::async_client instance(context, 2, configuration);
+    REQUIRE_SUCCESS(instance.connect({ TEST_SERVER_ENDPOINT }));
+
+    zmq::message request;
+    request.enqueue(TEST_MESSAGE);
+    auto result = zmq::error::code{ zmq::error::success };
+    auto resent = zmq::error::code{ zmq::error::success };
+    REQUIRE_SUCCESS(instance.send(request, 1000, [&](auto ec, auto&)
+    {
+        // The socket is closed before handlers are invoked.
+        result = ec;
+        zmq::message retry;
+        retry.enqueue(TEST_MESSAGE);
+        resent = instance.send(retry, 1000, [](auto, auto&) {});
+    }));
+
+    BOOST_REQUIRE(instance.stop());
+    BOOST_REQUIRE_EQUAL(result, zmq::error::context_terminated);
+    BOOST_REQUIRE(resent);
+    BOOST_REQUIRE_EQUAL(instance.pending(), 0u);
+    BOOST_REQUIRE(!instance);
+}
+
+BOOST_AUTO_TEST_CASE(async_client__process__no_server__timed_out)
+{
+    zmq::context context;
+    const settings configuration;
+    zmq::async_client instance(context, 1, configuration);
+    REQUIRE_SUCCESS(instance.connect({ TEST_SERVER_ENDPOINT }));
+
+    zmq::message request;
+    request.enqueue(TEST_MESSAGE);
+    auto result = zmq::error::code{ zmq::error::success };
+    REQUIRE_SUCCESS(instance.send(request, 1, [&](auto ec, auto&)
+    {
+        result = ec;
+    }));
+
+    while (!is_zero(instance.pending()))
+        REQUIRE_SUCCESS(instance.process(10));
+
+    BOOST_REQUIRE_EQUAL(result, zmq::error::timed_out);
+}
+
+BOOST_AUTO_TEST_CASE(async_client__process__reversed_replies__correlated)
+{
+    zmq::context context;
+    const settings configuration;
+
+    zmq::socket router(context, role::router);
+    BOOST_REQUIRE(router);
+    REQUIRE_SUCCESS(router.bind({ TEST_SERVER_ENDPOINT }));
+
+    zmq::async_client instance(context, 2, configuration);
+    REQUIRE_SUCCESS(instance.connect({ TEST_SERVER_ENDPOINT }));
+
+    std::string reply1;
+    std::string reply2;
+
+    zmq::message request1;
+    request1.enqueue("first");
+    REQUIRE_SUCCESS(instance.send(request1, 10000, [&](auto ec, auto& reply)
+    {
+        REQUIRE_SUCCESS(ec);
+        reply1 = reply.dequeue_text();
+    }));
+
+    zmq::message request2;
+    request2.enqueue("second");
+    REQUIRE_SUCCESS(instance.send(request2, 10000, [&](auto ec, auto& reply)
+    {
+        REQUIRE_SUCCESS(ec);
+        reply2 = reply.dequeue_text();
+    }));
+
+    // Echo the two requests (including envelopes) in reverse order.
+    simple_thread server([&]()
+    {
+        zmq::message in1;
+        zmq::message in2;
+        REQUIRE_SUCCESS(router.receive(in1));
+        REQUIRE_SUCCESS(router.receive(in2));
+        REQUIRE_SUCCESS(router.send(in2));
+        REQUIRE_SUCCESS(router.send(in1));
+    });
+
+    while (!is_zero(instance.pending()))
+        REQUIRE_SUCCESS(instance.process(100));
+
+    BOOST_REQUIRE_EQUAL(reply1, "first");
+    BOOST_REQUIRE_EQUAL(reply2, "second");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
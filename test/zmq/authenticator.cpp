@@ -300,6 +300,616 @@ BOOST_AUTO_TEST_CASE(authenticator__push_pull__strawhouse_good_deny_after_same_a
     RECEIVE_MESSAGE(puller);
 }
 
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__strawhouse_deny_after_start__failed)
+{
+    zmq::authenticator authenticator;
+    BOOST_REQUIRE(authenticator.start());
+    authenticator.deny(authority{ TEST_HOST });
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, false));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_FAILURE(puller);
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__strawhouse_deny_subnet__failed)
+{
+    zmq::authenticator authenticator;
+    authenticator.deny(subnet{ "127.0.0.0/8" });
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, false));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_FAILURE(puller);
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__strawhouse_allow_subnet__received)
+{
+    zmq::authenticator authenticator;
+    authenticator.allow(subnet{ "127.0.0.0/8" });
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, false));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_MESSAGE(puller);
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__strawhouse_removed_deny__received)
+{
+    zmq::authenticator authenticator;
+    authenticator.deny(subnet{ "127.0.0.0/8" });
+    authenticator.remove(subnet{ "127.0.0.0/8" });
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, false));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_MESSAGE(puller);
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__strawhouse_exchanged_deny__failed)
+{
+    zmq::authenticator authenticator;
+    zmq::authenticator::rules prior{};
+    prior.subnets.emplace_back(subnet{ "127.0.0.1" }, true);
+    zmq::authenticator::rules next{};
+    next.subnets.emplace_back(subnet{ "127.0.0.0/8" }, false);
+    authenticator.exchange({}, prior);
+    authenticator.exchange(prior, next);
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, false));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_FAILURE(puller);
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__strawhouse_allowed_rules__received)
+{
+    zmq::authenticator authenticator;
+    zmq::authenticator::rules allowed{};
+    allowed.subnets.emplace_back(subnet{ "10.0.0.0/8" }, true);
+    allowed.subnets.emplace_back(subnet{ "127.0.0.1" }, true);
+    authenticator.allow(allowed);
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, false));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_MESSAGE(puller);
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__strawhouse_removed_rules__failed)
+{
+    zmq::authenticator authenticator;
+    zmq::authenticator::rules allowed{};
+    allowed.subnets.emplace_back(subnet{ "127.0.0.1" }, true);
+    zmq::authenticator::rules other{};
+    other.subnets.emplace_back(subnet{ "10.0.0.0/8" }, true);
+    authenticator.allow(allowed);
+    authenticator.allow(other);
+    authenticator.remove(allowed);
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, false));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_FAILURE(puller);
+}
+
+// Send a NULL mechanism ZAP request directly to the authenticator.
+static void send_zap(zmq::socket& client, size_t sequence,
+    const std::string& address)
+{
+    zmq::message request;
+    request.enqueue();
+    request.enqueue(std::string{ "1.0" });
+    request.enqueue(std::to_string(sequence));
+    request.enqueue(std::string{ TEST_DOMAIN });
+    request.enqueue(address);
+    request.enqueue(std::string{});
+    request.enqueue(std::string{ "NULL" });
+    REQUIRE_SUCCESS(client.send(request));
+}
+
+// Receive a ZAP response, returning the status code and text by sequence.
+static void receive_zap(zmq::socket& client,
+    std::map<std::string, std::pair<std::string, std::string>>& out)
+{
+    zmq::message response;
+    REQUIRE_SUCCESS(client.receive(response));
+    BOOST_REQUIRE(response.dequeue());
+    BOOST_REQUIRE_EQUAL(response.dequeue_text(), "1.0");
+    const auto sequence = response.dequeue_text();
+    const auto code = response.dequeue_text();
+    const auto text = response.dequeue_text();
+    out.emplace(sequence, std::make_pair(code, text));
+}
+
+// pending limit
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__strawhouse_within_pending_limit__received)
+{
+    zmq::authenticator authenticator;
+    authenticator.set_pending_limit(1);
+    authenticator.allow(authority{ TEST_HOST });
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, false));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_MESSAGE(puller);
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__zap__over_pending_limit__pending_limited)
+{
+    constexpr size_t requests = 10;
+    zmq::authenticator authenticator;
+    authenticator.set_pending_limit(1);
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket client(authenticator, role::dealer);
+    BOOST_REQUIRE(client);
+    REQUIRE_SUCCESS(client.connect(zmq::authenticator::authentication_point));
+
+    // The frontend evaluates queued requests before it receives the first
+    // response from a handler, so at least one exceeds the limit of one.
+    for (size_t sequence = 0; sequence < requests; ++sequence)
+        send_zap(client, sequence, TEST_HOST);
+
+    std::map<std::string, std::pair<std::string, std::string>> responses{};
+    for (size_t sequence = 0; sequence < requests; ++sequence)
+        receive_zap(client, responses);
+
+    BOOST_REQUIRE_EQUAL(responses.size(), requests);
+    BOOST_REQUIRE_EQUAL(responses["0"].first, "200");
+
+    size_t limited{};
+    for (const auto& [sequence, status]: responses)
+    {
+        if (status.first == "300")
+        {
+            BOOST_REQUIRE_EQUAL(status.second, "Too many pending requests.");
+            ++limited;
+        }
+    }
+
+    BOOST_REQUIRE(!is_zero(limited));
+}
+
+// rate limit
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__strawhouse_within_rate_limit__received)
+{
+    zmq::authenticator authenticator;
+    authenticator.set_rate_limit(1, 1);
+    authenticator.allow(authority{ TEST_HOST });
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, false));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_MESSAGE(puller);
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__zap__over_rate_limit__rate_limited)
+{
+    zmq::authenticator authenticator;
+    authenticator.set_rate_limit(1, 1);
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket client(authenticator, role::dealer);
+    BOOST_REQUIRE(client);
+    REQUIRE_SUCCESS(client.connect(zmq::authenticator::authentication_point));
+
+    // The burst of one admits the first request of the address only.
+    send_zap(client, 0, TEST_HOST);
+    send_zap(client, 1, TEST_HOST);
+    send_zap(client, 2, TEST_HOST);
+
+    std::map<std::string, std::pair<std::string, std::string>> responses{};
+    receive_zap(client, responses);
+    receive_zap(client, responses);
+    receive_zap(client, responses);
+
+    BOOST_REQUIRE_EQUAL(responses.size(), 3u);
+    BOOST_REQUIRE_EQUAL(responses["0"].first, "200");
+    BOOST_REQUIRE_EQUAL(responses["1"].first, "400");
+    BOOST_REQUIRE_EQUAL(responses["1"].second, "Rate limit exceeded.");
+    BOOST_REQUIRE_EQUAL(responses["2"].first, "400");
+    BOOST_REQUIRE_EQUAL(responses["2"].second, "Rate limit exceeded.");
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__zap__other_address_within_rate_limit__allowed)
+{
+    zmq::authenticator authenticator;
+    authenticator.set_rate_limit(1, 1);
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket client(authenticator, role::dealer);
+    BOOST_REQUIRE(client);
+    REQUIRE_SUCCESS(client.connect(zmq::authenticator::authentication_point));
+
+    // Each address has its own bucket.
+    send_zap(client, 0, TEST_HOST);
+    send_zap(client, 1, TEST_HOST_BAD);
+
+    std::map<std::string, std::pair<std::string, std::string>> responses{};
+    receive_zap(client, responses);
+    receive_zap(client, responses);
+
+    BOOST_REQUIRE_EQUAL(responses["0"].first, "200");
+    BOOST_REQUIRE_EQUAL(responses["1"].first, "200");
+}
+
+// apply (transport)
+
+BOOST_AUTO_TEST_CASE(authenticator__apply__ipc_empty_domain__true)
+{
+    zmq::authenticator authenticator;
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, "", true,
+        endpoint{ "ipc://testing" }));
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__apply__ipc_domain__true)
+{
+    zmq::authenticator authenticator;
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, true,
+        endpoint{ "ipc://testing" }));
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__ipc_domain_with_allow__received)
+{
+    // The address whitelist does not apply to (addressless) ipc clients.
+    zmq::authenticator authenticator;
+    authenticator.allow(authority{ TEST_HOST });
+    BOOST_REQUIRE(authenticator.start());
+
+    const endpoint ipc{ "ipc://testing" };
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, true, ipc));
+    REQUIRE_SUCCESS(pusher.bind(ipc));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect(ipc));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_MESSAGE(puller);
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__inproc_secure_uncertified__received)
+{
+    const zmq::certificate server_certificate;
+    BOOST_REQUIRE(server_certificate);
+
+    const zmq::certificate client_certificate;
+    BOOST_REQUIRE(client_certificate);
+
+    // Curve is required for tcp, but not applied to inproc.
+    zmq::authenticator authenticator;
+    authenticator.set_private_key(server_certificate.private_key());
+    authenticator.allow(client_certificate.public_key());
+    BOOST_REQUIRE(authenticator.start());
+
+    const endpoint inproc{ TEST_INPROC_ENDPOINT };
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, true, inproc));
+    REQUIRE_SUCCESS(pusher.bind(inproc));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect(inproc));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_MESSAGE(puller);
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__tcp_secure_uncertified__failed)
+{
+    const zmq::certificate server_certificate;
+    BOOST_REQUIRE(server_certificate);
+
+    const zmq::certificate client_certificate;
+    BOOST_REQUIRE(client_certificate);
+
+    zmq::authenticator authenticator;
+    authenticator.set_private_key(server_certificate.private_key());
+    authenticator.allow(client_certificate.public_key());
+    BOOST_REQUIRE(authenticator.start());
+
+    const endpoint tcp{ TEST_PUBLIC_ENDPOINT };
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, true, tcp));
+    REQUIRE_SUCCESS(pusher.bind(tcp));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect(tcp));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_FAILURE(puller);
+}
+
+// metrics
+
+BOOST_AUTO_TEST_CASE(authenticator__metrics__not_started__zeroed)
+{
+    const zmq::authenticator authenticator;
+    const auto metrics = authenticator.metrics();
+    BOOST_REQUIRE(is_zero(metrics.success));
+    BOOST_REQUIRE(is_zero(metrics.failure));
+    BOOST_REQUIRE(is_zero(metrics.pending));
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__metrics__strawhouse_received__success_counted)
+{
+    zmq::authenticator authenticator;
+    authenticator.allow(authority{ TEST_HOST });
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, false));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_MESSAGE(puller);
+
+    constexpr auto allowed = zmq::authenticator::reason::allowed_null;
+    const auto metrics = authenticator.metrics();
+    BOOST_REQUIRE(!is_zero(metrics.success));
+    BOOST_REQUIRE(!is_zero(metrics.decisions[static_cast<size_t>(allowed)]));
+    BOOST_REQUIRE(is_zero(metrics.failure));
+    BOOST_REQUIRE(is_zero(metrics.pending));
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__metrics__ironhouse_received__allowed_curve_counted)
+{
+    const zmq::certificate server_certificate;
+    BOOST_REQUIRE(server_certificate);
+
+    const zmq::certificate client_certificate;
+    BOOST_REQUIRE(client_certificate);
+
+    zmq::authenticator authenticator;
+    authenticator.set_private_key(server_certificate.private_key());
+    authenticator.allow(client_certificate.public_key());
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, true));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    BOOST_REQUIRE(puller.set_curve_client(server_certificate.public_key()));
+    BOOST_REQUIRE(puller.set_certificate(client_certificate));
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_MESSAGE(puller);
+
+    using reason = zmq::authenticator::reason;
+    const auto metrics = authenticator.metrics();
+    BOOST_REQUIRE_EQUAL(metrics.success, 1u);
+    BOOST_REQUIRE_EQUAL(
+        metrics.decisions[static_cast<size_t>(reason::allowed_curve)], 1u);
+    BOOST_REQUIRE(is_zero(
+        metrics.decisions[static_cast<size_t>(reason::allowed_null)]));
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__metrics__ironhouse_unallowed__curve_key_denied_counted)
+{
+    const zmq::certificate server_certificate;
+    BOOST_REQUIRE(server_certificate);
+
+    const zmq::certificate client_certificate;
+    BOOST_REQUIRE(client_certificate);
+
+    const zmq::certificate other_certificate;
+    BOOST_REQUIRE(other_certificate);
+
+    zmq::authenticator authenticator;
+    authenticator.set_private_key(server_certificate.private_key());
+    authenticator.allow(other_certificate.public_key());
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, true));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    BOOST_REQUIRE(puller.set_curve_client(server_certificate.public_key()));
+    BOOST_REQUIRE(puller.set_certificate(client_certificate));
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_FAILURE(puller);
+
+    using reason = zmq::authenticator::reason;
+    const auto metrics = authenticator.metrics();
+    BOOST_REQUIRE(is_zero(metrics.success));
+    BOOST_REQUIRE(!is_zero(metrics.failure));
+    BOOST_REQUIRE(!is_zero(
+        metrics.decisions[static_cast<size_t>(reason::curve_key_denied)]));
+}
+
+// decision cache
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__strawhouse_decision_cache_reconnect__received)
+{
+    zmq::authenticator authenticator;
+    authenticator.set_decision_cache(100, 60000);
+    authenticator.allow(authority{ TEST_HOST });
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, false));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    {
+        zmq::socket puller(authenticator, role::puller);
+        BOOST_REQUIRE(puller);
+        REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+        SEND_MESSAGE(pusher);
+        RECEIVE_MESSAGE(puller);
+    }
+
+    // The second handshake is decided from the cache.
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_MESSAGE(puller);
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__strawhouse_decision_cache_policy_changed__failed)
+{
+    zmq::authenticator authenticator;
+    authenticator.set_decision_cache(100, 60000);
+    authenticator.deny(authority{ TEST_HOST_BAD });
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, false));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    {
+        zmq::socket puller(authenticator, role::puller);
+        BOOST_REQUIRE(puller);
+        REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+        SEND_MESSAGE(pusher);
+        RECEIVE_MESSAGE(puller);
+    }
+
+    // The policy change invalidates the cached decision.
+    authenticator.deny(authority{ TEST_HOST });
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_FAILURE(puller);
+}
+
+// handler threads
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__strawhouse_multiple_threads__received)
+{
+    zmq::authenticator authenticator(thread_priority::normal, 4);
+    authenticator.allow(authority{ TEST_HOST });
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, false));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_MESSAGE(puller);
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__stop__multiple_threads__true)
+{
+    zmq::authenticator authenticator(thread_priority::normal, 4);
+    BOOST_REQUIRE(authenticator.start());
+    BOOST_REQUIRE(authenticator.stop());
+}
+
 // grasslands (public and anonymous)
 // The grasslands pattern does not require the authenticator.
 // The authenticator is used for client indentity validation (i.e. IP address/cert/password).
@@ -347,6 +957,17 @@ BOOST_AUTO_TEST_CASE(authenticator__push_pull__grasslands_secure_certified__fail
     RECEIVE_FAILURE(puller);
 }
 
+BOOST_AUTO_TEST_CASE(authenticator__set_key_store__invalid_store__false)
+{
+    BOOST_REQUIRE(test::clear(test::directory));
+    const auto store = std::make_shared<const zmq::key_store>(TEST_PATH);
+    BOOST_REQUIRE(!*store);
+
+    zmq::authenticator authenticator;
+    BOOST_REQUIRE(!authenticator.set_key_store(store));
+    BOOST_REQUIRE(authenticator.set_key_store(nullptr));
+}
+
 // When misconfigured PUSH-PULL may block on send when authenticator is REP (vs. ROUTER).
 ////BOOST_AUTO_TEST_CASE(authenticator__push_pull__grasslands_secure__blocked)
 ////{
@@ -520,6 +1141,73 @@ BOOST_AUTO_TEST_CASE(authenticator__push_pull__ironhouse_authorized__received)
     RECEIVE_MESSAGE(puller);
 }
 
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__ironhouse_granted__expected_properties)
+{
+    const zmq::certificate server_certificate;
+    BOOST_REQUIRE(server_certificate);
+
+    const zmq::certificate client_certificate;
+    BOOST_REQUIRE(client_certificate);
+
+    zmq::authenticator authenticator;
+    authenticator.set_private_key(server_certificate.private_key());
+    authenticator.allow(client_certificate.public_key(),
+        { "alice", { { "Tier", "gold" } } });
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    BOOST_REQUIRE(authenticator.apply(puller, TEST_DOMAIN, true));
+    REQUIRE_SUCCESS(puller.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(pusher.set_curve_client(server_certificate.public_key()));
+    BOOST_REQUIRE(pusher.set_certificate(client_certificate));
+    REQUIRE_SUCCESS(pusher.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+
+    zmq::frame frame{};
+    REQUIRE_SUCCESS(frame.receive(puller));
+    BOOST_REQUIRE_EQUAL(frame.property("User-Id"), "alice");
+    BOOST_REQUIRE_EQUAL(frame.property("Tier"), "gold");
+}
+
+BOOST_AUTO_TEST_CASE(authenticator__push_pull__ironhouse_key_store_authorized__received)
+{
+    const zmq::certificate server_certificate;
+    BOOST_REQUIRE(server_certificate);
+
+    const zmq::certificate client_certificate;
+    BOOST_REQUIRE(client_certificate);
+
+    BOOST_REQUIRE(test::clear(test::directory));
+    const hash_digest& client_key = client_certificate.public_key();
+    BOOST_REQUIRE(zmq::key_store::create(TEST_PATH, { client_key }));
+    const auto store = std::make_shared<const zmq::key_store>(TEST_PATH);
+    BOOST_REQUIRE(*store);
+
+    zmq::authenticator authenticator;
+    authenticator.set_private_key(server_certificate.private_key());
+    BOOST_REQUIRE(authenticator.set_key_store(store));
+    BOOST_REQUIRE(authenticator.start());
+
+    zmq::socket pusher(authenticator, role::pusher);
+    BOOST_REQUIRE(pusher);
+    BOOST_REQUIRE(authenticator.apply(pusher, TEST_DOMAIN, true));
+    REQUIRE_SUCCESS(pusher.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket puller(authenticator, role::puller);
+    BOOST_REQUIRE(puller);
+    BOOST_REQUIRE(puller.set_curve_client(server_certificate.public_key()));
+    BOOST_REQUIRE(puller.set_certificate(client_certificate));
+    REQUIRE_SUCCESS(puller.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(pusher);
+    RECEIVE_MESSAGE(puller);
+}
+
 // When misconfigured PUSH-PULL may block on send when authenticator is REP (vs. ROUTER).
 ////BOOST_AUTO_TEST_CASE(authenticator__push_pull__ironhouse_unapplied__blocked)
 ////{
@@ -108,3 +108,115 @@ BOOST_AUTO_TEST_CASE(certificate__create__setting__valid_keypair)
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+struct certificate_store_setup_fixture
+{
+    DELETE_COPY_MOVE(certificate_store_setup_fixture);
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+    certificate_store_setup_fixture() NOEXCEPT
+    {
+        BOOST_REQUIRE(test::clear(test::directory));
+    }
+
+    ~certificate_store_setup_fixture() NOEXCEPT
+    {
+        BOOST_REQUIRE(test::clear(test::directory));
+    }
+
+    BC_POP_WARNING()
+};
+
+BOOST_FIXTURE_TEST_SUITE(certificate_store_tests,
+    certificate_store_setup_fixture)
+
+// generate
+
+BOOST_AUTO_TEST_CASE(certificate__generate__zero__empty)
+{
+    BOOST_REQUIRE(certificate::generate(0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(certificate__generate__multiple_threads__valid_distinct)
+{
+    const auto certificates = certificate::generate(8, 3);
+    BOOST_REQUIRE_EQUAL(certificates.size(), 8u);
+
+    std::set<std::string> keys{};
+    for (const auto& instance: certificates)
+    {
+        BOOST_REQUIRE(is_valid(instance.public_key(), true));
+        BOOST_REQUIRE(is_valid(instance.private_key(), true));
+        keys.insert(instance.public_key().to_string());
+    }
+
+    BOOST_REQUIRE_EQUAL(keys.size(), 8u);
+}
+
+BOOST_AUTO_TEST_CASE(certificate__generate__consistent__derives_public_key)
+{
+    const auto certificates = certificate::generate(2, 2, false);
+    BOOST_REQUIRE_EQUAL(certificates.size(), 2u);
+
+    for (const auto& instance: certificates)
+    {
+        const certificate derived{ instance.private_key() };
+        BOOST_REQUIRE_EQUAL(derived.public_key().to_string(),
+            instance.public_key().to_string());
+    }
+}
+
+// save/load
+
+BOOST_AUTO_TEST_CASE(certificate__load__missing_file__false)
+{
+    certificate::list out{};
+    BOOST_REQUIRE(!certificate::load(out, TEST_PATH));
+}
+
+BOOST_AUTO_TEST_CASE(certificate__load__malformed_size__false)
+{
+    BOOST_REQUIRE(test::create(TEST_PATH));
+    std::ofstream(TEST_PATH) << "malformed";
+
+    certificate::list out{};
+    BOOST_REQUIRE(!certificate::load(out, TEST_PATH));
+}
+
+BOOST_AUTO_TEST_CASE(certificate__save__loaded__round_trip)
+{
+    const auto certificates = certificate::generate(4);
+    BOOST_REQUIRE(certificate::save(TEST_PATH, certificates));
+    BOOST_REQUIRE_EQUAL(std::filesystem::file_size(TEST_PATH), 4u * 64u);
+
+    certificate::list out{};
+    BOOST_REQUIRE(certificate::load(out, TEST_PATH));
+    BOOST_REQUIRE_EQUAL(out.size(), certificates.size());
+
+    for (size_t index = 0; index < out.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(out[index].public_key().to_string(),
+            certificates[index].public_key().to_string());
+        BOOST_REQUIRE_EQUAL(out[index].private_key().to_string(),
+            certificates[index].private_key().to_string());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(certificate__save__existing_file__replaced_owner_only)
+{
+    BOOST_REQUIRE(test::create(TEST_PATH));
+    std::filesystem::permissions(TEST_PATH, std::filesystem::perms::all);
+
+    const auto certificates = certificate::generate(1);
+    BOOST_REQUIRE(certificate::save(TEST_PATH, certificates));
+    BOOST_REQUIRE_EQUAL(std::filesystem::file_size(TEST_PATH), 64u);
+
+#if !defined(HAVE_MSC)
+    using perms = std::filesystem::perms;
+    const auto permissions = std::filesystem::status(TEST_PATH).permissions();
+    BOOST_REQUIRE((permissions & (perms::group_all | perms::others_all)) ==
+        perms::none);
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
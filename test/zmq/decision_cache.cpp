@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(decision_cache_tests)
+
+using cache_clock = zmq::decision_cache::clock;
+constexpr std::chrono::milliseconds ttl{ 1000 };
+const zmq::decision_cache::decision allowed{ 42, { 0x01 }, { 0x02 } };
+
+BOOST_AUTO_TEST_CASE(decision_cache__enabled__zero_capacity__false)
+{
+    const zmq::decision_cache instance{ 0, ttl };
+    BOOST_REQUIRE(!instance.enabled());
+}
+
+BOOST_AUTO_TEST_CASE(decision_cache__enabled__zero_ttl__false)
+{
+    const zmq::decision_cache instance{ 1, std::chrono::milliseconds{ 0 } };
+    BOOST_REQUIRE(!instance.enabled());
+}
+
+BOOST_AUTO_TEST_CASE(decision_cache__find__inserted__expected)
+{
+    const auto now = cache_clock::now();
+    zmq::decision_cache instance{ 10, ttl };
+    instance.insert("a", allowed, 1, now);
+
+    zmq::decision_cache::decision out{};
+    BOOST_REQUIRE(instance.find(out, "a", 1, now));
+    BOOST_REQUIRE_EQUAL(out.reason, 42u);
+    BOOST_REQUIRE_EQUAL(out.user_id, allowed.user_id);
+    BOOST_REQUIRE_EQUAL(out.metadata, allowed.metadata);
+    BOOST_REQUIRE(!instance.find(out, "b", 1, now));
+}
+
+BOOST_AUTO_TEST_CASE(decision_cache__find__changed_generation__false_removed)
+{
+    const auto now = cache_clock::now();
+    zmq::decision_cache instance{ 10, ttl };
+    instance.insert("a", allowed, 1, now);
+
+    zmq::decision_cache::decision out{};
+    BOOST_REQUIRE(!instance.find(out, "a", 2, now));
+    BOOST_REQUIRE(is_zero(instance.size()));
+}
+
+BOOST_AUTO_TEST_CASE(decision_cache__find__expired__false)
+{
+    const auto now = cache_clock::now();
+    zmq::decision_cache instance{ 10, ttl };
+    instance.insert("a", allowed, 1, now);
+
+    zmq::decision_cache::decision out{};
+    BOOST_REQUIRE(!instance.find(out, "a", 1, now + ttl));
+}
+
+BOOST_AUTO_TEST_CASE(decision_cache__insert__over_capacity__least_recent_evicted)
+{
+    const auto now = cache_clock::now();
+    zmq::decision_cache instance{ 2, ttl };
+    instance.insert("a", allowed, 1, now);
+    instance.insert("b", allowed, 1, now);
+
+    zmq::decision_cache::decision out{};
+    BOOST_REQUIRE(instance.find(out, "a", 1, now));
+    instance.insert("c", allowed, 1, now);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE(instance.find(out, "a", 1, now));
+    BOOST_REQUIRE(!instance.find(out, "b", 1, now));
+    BOOST_REQUIRE(instance.find(out, "c", 1, now));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -196,4 +196,22 @@ BOOST_AUTO_TEST_CASE(zmq_error_t__code__invalid_socket__true_exected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "invalid socket");
 }
 
+BOOST_AUTO_TEST_CASE(zmq_error_t__code__sequence_gap__true_exected_message)
+{
+    constexpr auto value = error::sequence_gap;
+    const auto ec = error::code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "sequence gap not recoverable");
+}
+
+BOOST_AUTO_TEST_CASE(zmq_error_t__code__timed_out__true_exected_message)
+{
+    constexpr auto value = error::timed_out;
+    const auto ec = error::code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "request timed out");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../utility.hpp"
+
+using namespace bc::system;
+using namespace bc::system::config;
+using namespace bc::protocol;
+using role = zmq::socket::role;
+
+BOOST_AUTO_TEST_SUITE(failover_client_tests)
+
+#define TEST_DEAD_ENDPOINT "inproc://dead"
+#define TEST_LIVE_ENDPOINT "inproc://live"
+
+// Reply to one request with the request.
+static void echo(zmq::socket& replier)
+{
+    zmq::message request;
+    REQUIRE_SUCCESS(replier.receive(request));
+    REQUIRE_SUCCESS(replier.send(request));
+}
+
+BOOST_AUTO_TEST_CASE(failover_client__request__no_servers__resolve_failed)
+{
+    zmq::context context;
+    const settings configuration;
+    zmq::failover_client instance(context, {}, 10, 1, configuration);
+
+    zmq::message request;
+    zmq::message reply;
+    BOOST_REQUIRE_EQUAL(instance.request(request, reply),
+        zmq::error::resolve_failed);
+}
+
+BOOST_AUTO_TEST_CASE(failover_client__request__live_server__replied)
+{
+    zmq::context context;
+    const settings configuration;
+
+    zmq::socket replier(context, role::replier);
+    BOOST_REQUIRE(replier);
+    REQUIRE_SUCCESS(replier.bind({ TEST_LIVE_ENDPOINT }));
+    simple_thread server([&]() { echo(replier); });
+
+    zmq::failover_client instance(context, { endpoint{ TEST_LIVE_ENDPOINT } },
+        1000, 0, configuration);
+
+    zmq::message request;
+    request.enqueue(TEST_MESSAGE);
+    zmq::message reply;
+    REQUIRE_SUCCESS(instance.request(request, reply));
+    BOOST_REQUIRE(request.empty());
+    BOOST_REQUIRE_EQUAL(reply.dequeue_text(), TEST_MESSAGE);
+}
+
+BOOST_AUTO_TEST_CASE(failover_client__request__dead_then_live_server__failed_over)
+{
+    zmq::context context;
+    const settings configuration;
+
+    zmq::socket replier(context, role::replier);
+    BOOST_REQUIRE(replier);
+    REQUIRE_SUCCESS(replier.bind({ TEST_LIVE_ENDPOINT }));
+    simple_thread server([&]() { echo(replier); });
+
+    zmq::failover_client instance(context,
+    {
+        endpoint{ TEST_DEAD_ENDPOINT },
+        endpoint{ TEST_LIVE_ENDPOINT }
+    }, 10, 1, configuration);
+
+    zmq::message request;
+    request.enqueue(TEST_MESSAGE);
+    zmq::message reply;
+    REQUIRE_SUCCESS(instance.request(request, reply));
+    BOOST_REQUIRE_EQUAL(reply.dequeue_text(), TEST_MESSAGE);
+    BOOST_REQUIRE_EQUAL(instance.server(), endpoint{ TEST_LIVE_ENDPOINT });
+}
+
+BOOST_AUTO_TEST_CASE(failover_client__request__dead_servers__timed_out_retained)
+{
+    zmq::context context;
+    const settings configuration;
+    zmq::failover_client instance(context, { endpoint{ TEST_DEAD_ENDPOINT } },
+        10, 2, configuration);
+
+    zmq::message request;
+    request.enqueue(TEST_MESSAGE);
+    zmq::message reply;
+    BOOST_REQUIRE_EQUAL(instance.request(request, reply),
+        zmq::error::timed_out);
+    BOOST_REQUIRE_EQUAL(request.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(failover_client__request__dead_servers__delayed_before_retries)
+{
+    zmq::context context;
+    settings configuration;
+    configuration.reconnect_milliseconds = 20;
+    zmq::failover_client instance(context, { endpoint{ TEST_DEAD_ENDPOINT } },
+        1, 3, configuration);
+
+    zmq::message request;
+    request.enqueue(TEST_MESSAGE);
+    zmq::message reply;
+    const auto start = std::chrono::steady_clock::now();
+    BOOST_REQUIRE_EQUAL(instance.request(request, reply),
+        zmq::error::timed_out);
+
+    // Retries wait 20, 40 and 80 milliseconds, in addition to the timeouts.
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    BOOST_REQUIRE(elapsed >= std::chrono::milliseconds(140));
+}
+
+BOOST_AUTO_TEST_CASE(failover_client__heartbeat__dead_server__timed_out)
+{
+    zmq::context context;
+    const settings configuration;
+    zmq::failover_client instance(context, { endpoint{ TEST_DEAD_ENDPOINT } },
+        10, 0, configuration);
+    BOOST_REQUIRE_EQUAL(instance.heartbeat(), zmq::error::timed_out);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,9 +17,11 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include "../utility.hpp"
 
 using namespace bc::system;
 using namespace bc::protocol::zmq;
+using role = bc::protocol::zmq::socket::role;
 
 BOOST_AUTO_TEST_SUITE(frame_tests)
 
@@ -84,4 +86,86 @@ BOOST_AUTO_TEST_CASE(frame__constuctor2__non_empty__expected_payload)
     BOOST_REQUIRE(instance.payload() == expected);
 }
 
+// constuctor3
+
+BOOST_AUTO_TEST_CASE(frame__constuctor3__empty__valid_empty_payload)
+{
+    const frame instance{ data_chunk{} };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.payload().empty());
+}
+
+BOOST_AUTO_TEST_CASE(frame__constuctor3__small__expected_payload)
+{
+    static const data_chunk expected{ 0xba, 0xad, 0xf0, 0x0d };
+    auto copy = expected;
+    const frame instance{ std::move(copy) };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.payload() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(frame__constuctor3__large__expected_payload)
+{
+    const data_chunk expected(zmq_minimum_shared_size, 0x42);
+    auto copy = expected;
+    const frame instance{ std::move(copy) };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE(instance.payload() == expected);
+}
+
+// view
+
+BOOST_AUTO_TEST_CASE(frame__view__empty__empty)
+{
+    const frame instance;
+    BOOST_REQUIRE(instance.view().empty());
+}
+
+BOOST_AUTO_TEST_CASE(frame__view__non_empty__expected)
+{
+    const data_chunk expected{ 0x01, 0x02, 0x03 };
+    const frame instance{ expected };
+    BOOST_REQUIRE_EQUAL(instance.view().to_chunk(), expected);
+}
+
+// property
+
+BOOST_AUTO_TEST_CASE(frame__property__not_received__empty)
+{
+    const frame instance;
+    BOOST_REQUIRE(instance.property("User-Id").empty());
+}
+
+// share
+
+BOOST_AUTO_TEST_CASE(frame__share__two_sockets__payload_retained_and_received)
+{
+    const data_chunk expected(zmq_minimum_shared_size, 0x42);
+
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket pusher1(context, role::pusher);
+    zmq::socket pusher2(context, role::pusher);
+    zmq::socket puller1(context, role::puller);
+    zmq::socket puller2(context, role::puller);
+    REQUIRE_SUCCESS(pusher1.bind({ "inproc://frame1" }));
+    REQUIRE_SUCCESS(pusher2.bind({ "inproc://frame2" }));
+    REQUIRE_SUCCESS(puller1.connect({ "inproc://frame1" }));
+    REQUIRE_SUCCESS(puller2.connect({ "inproc://frame2" }));
+
+    auto copy = expected;
+    frame instance{ std::move(copy) };
+    REQUIRE_SUCCESS(instance.share(pusher1, true));
+    REQUIRE_SUCCESS(instance.share(pusher2, true));
+    BOOST_REQUIRE(instance.payload() == expected);
+
+    frame received1;
+    frame received2;
+    REQUIRE_SUCCESS(received1.receive(puller1));
+    REQUIRE_SUCCESS(received2.receive(puller2));
+    BOOST_REQUIRE(received1.payload() == expected);
+    BOOST_REQUIRE(received2.payload() == expected);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(histogram_tests)
+
+using namespace std::chrono;
+
+BOOST_AUTO_TEST_CASE(histogram__bucket__small__exact)
+{
+    BOOST_REQUIRE_EQUAL(zmq::histogram::bucket(0), 0u);
+    BOOST_REQUIRE_EQUAL(zmq::histogram::bucket(1), 1u);
+    BOOST_REQUIRE_EQUAL(zmq::histogram::bucket(3), 3u);
+    BOOST_REQUIRE_EQUAL(zmq::histogram::bucket(7), 7u);
+}
+
+BOOST_AUTO_TEST_CASE(histogram__bucket__octaves__four_per_octave)
+{
+    BOOST_REQUIRE_EQUAL(zmq::histogram::bucket(8), 8u);
+    BOOST_REQUIRE_EQUAL(zmq::histogram::bucket(9), 8u);
+    BOOST_REQUIRE_EQUAL(zmq::histogram::bucket(10), 9u);
+    BOOST_REQUIRE_EQUAL(zmq::histogram::bucket(15), 11u);
+    BOOST_REQUIRE_EQUAL(zmq::histogram::bucket(16), 12u);
+}
+
+BOOST_AUTO_TEST_CASE(histogram__bucket__excessive__last)
+{
+    BOOST_REQUIRE_EQUAL(zmq::histogram::bucket(max_uint64),
+        sub1(zmq::histogram::buckets));
+}
+
+BOOST_AUTO_TEST_CASE(histogram__lower_bound__each_bucket__round_trips)
+{
+    for (size_t bucket = 0; bucket < zmq::histogram::buckets; ++bucket)
+    {
+        const auto bound = zmq::histogram::lower_bound(bucket);
+        BOOST_REQUIRE_EQUAL(zmq::histogram::bucket(bound), bucket);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(histogram__get__default__zeroed)
+{
+    const zmq::histogram instance{};
+    const auto snapshot = instance.get();
+    BOOST_REQUIRE(is_zero(snapshot.count));
+    BOOST_REQUIRE(is_zero(snapshot.sum));
+    BOOST_REQUIRE(is_zero(snapshot.maximum));
+    BOOST_REQUIRE(is_zero(snapshot.quantile(0.5)));
+}
+
+BOOST_AUTO_TEST_CASE(histogram__record__durations__expected_counts)
+{
+    zmq::histogram instance{};
+    instance.record(microseconds{ 1 });
+    instance.record(microseconds{ 9 });
+    instance.record(microseconds{ 100 });
+    instance.record(microseconds{ -1 });
+
+    const auto snapshot = instance.get();
+    BOOST_REQUIRE_EQUAL(snapshot.count, 4u);
+    BOOST_REQUIRE_EQUAL(snapshot.sum, 110u);
+    BOOST_REQUIRE_EQUAL(snapshot.maximum, 100u);
+    BOOST_REQUIRE_EQUAL(snapshot.counts[0], 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.counts[1], 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.counts[8], 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.counts[zmq::histogram::bucket(100)], 1u);
+}
+
+BOOST_AUTO_TEST_CASE(histogram__quantile__recorded__lower_bounds)
+{
+    zmq::histogram instance{};
+    for (auto count = 0; count < 99; ++count)
+        instance.record(microseconds{ 2 });
+
+    instance.record(milliseconds{ 1 });
+
+    const auto snapshot = instance.get();
+    BOOST_REQUIRE_EQUAL(snapshot.quantile(0.0), 2u);
+    BOOST_REQUIRE_EQUAL(snapshot.quantile(0.5), 2u);
+    BOOST_REQUIRE_EQUAL(snapshot.quantile(0.99), 2u);
+    BOOST_REQUIRE_EQUAL(snapshot.quantile(1.0), 896u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
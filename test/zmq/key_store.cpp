@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::system;
+
+struct key_store_setup_fixture
+{
+    DELETE_COPY_MOVE(key_store_setup_fixture);
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+    key_store_setup_fixture() NOEXCEPT
+    {
+        BOOST_REQUIRE(test::clear(test::directory));
+    }
+
+    ~key_store_setup_fixture() NOEXCEPT
+    {
+        BOOST_REQUIRE(test::clear(test::directory));
+    }
+
+    BC_POP_WARNING()
+};
+
+BOOST_FIXTURE_TEST_SUITE(key_store_tests, key_store_setup_fixture)
+
+constexpr hash_digest key1 = base16_array("0000000000000000000000000000000000000000000000000000000000000001");
+constexpr hash_digest key2 = base16_array("0000000000000000000000000000000000000000000000000000000000000002");
+constexpr hash_digest key3 = base16_array("0000000000000000000000000000000000000000000000000000000000000003");
+
+BOOST_AUTO_TEST_CASE(key_store__construct__missing_file__invalid)
+{
+    const zmq::key_store instance{ TEST_PATH };
+    BOOST_REQUIRE(!instance);
+    BOOST_REQUIRE(is_zero(instance.size()));
+    BOOST_REQUIRE(!instance.contains(key1));
+}
+
+BOOST_AUTO_TEST_CASE(key_store__construct__empty_file__invalid)
+{
+    BOOST_REQUIRE(test::create(TEST_PATH));
+    const zmq::key_store instance{ TEST_PATH };
+    BOOST_REQUIRE(!instance);
+}
+
+BOOST_AUTO_TEST_CASE(key_store__create__unsorted_duplicates__sorted_unique)
+{
+    BOOST_REQUIRE(zmq::key_store::create(TEST_PATH, { key3, key1, key3 }));
+    const zmq::key_store instance{ TEST_PATH };
+    BOOST_REQUIRE(instance);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(key_store__contains__stored_and_not_stored__expected)
+{
+    BOOST_REQUIRE(zmq::key_store::create(TEST_PATH, { key3, key1 }));
+    const zmq::key_store instance{ TEST_PATH };
+    BOOST_REQUIRE(instance.contains(key1));
+    BOOST_REQUIRE(!instance.contains(key2));
+    BOOST_REQUIRE(instance.contains(key3));
+}
+
+BOOST_AUTO_TEST_CASE(key_store__construct__unsorted_file__invalid)
+{
+    std::ofstream file(TEST_PATH, std::ios::binary);
+    file.write(pointer_cast<const char>(key3.data()), key3.size());
+    file.write(pointer_cast<const char>(key1.data()), key1.size());
+    file.close();
+
+    const zmq::key_store instance{ TEST_PATH };
+    BOOST_REQUIRE(!instance);
+    BOOST_REQUIRE(is_zero(instance.size()));
+    BOOST_REQUIRE(!instance.contains(key1));
+}
+
+BOOST_AUTO_TEST_CASE(key_store__construct__duplicated_file__invalid)
+{
+    std::ofstream file(TEST_PATH, std::ios::binary);
+    file.write(pointer_cast<const char>(key1.data()), key1.size());
+    file.write(pointer_cast<const char>(key1.data()), key1.size());
+    file.close();
+
+    const zmq::key_store instance{ TEST_PATH };
+    BOOST_REQUIRE(!instance);
+    BOOST_REQUIRE(is_zero(instance.size()));
+    BOOST_REQUIRE(!instance.contains(key1));
+}
+
+BOOST_AUTO_TEST_CASE(key_store__create__mapped_store__replaced_and_mapping_retained)
+{
+    BOOST_REQUIRE(zmq::key_store::create(TEST_PATH, { key1, key2 }));
+    const zmq::key_store original{ TEST_PATH };
+    BOOST_REQUIRE(original);
+
+    BOOST_REQUIRE(zmq::key_store::create(TEST_PATH, { key3 }));
+    BOOST_REQUIRE(original.contains(key1));
+    BOOST_REQUIRE(original.contains(key2));
+    BOOST_REQUIRE(!original.contains(key3));
+
+    const zmq::key_store replaced{ TEST_PATH };
+    BOOST_REQUIRE_EQUAL(replaced.size(), 1u);
+    BOOST_REQUIRE(!replaced.contains(key1));
+    BOOST_REQUIRE(replaced.contains(key3));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../utility.hpp"
+
+using namespace bc::system;
+using namespace bc::system::config;
+using namespace bc::protocol;
+using role = zmq::socket::role;
+
+BOOST_AUTO_TEST_SUITE(last_value_cache_tests)
+
+#define TEST_UPSTREAM_ENDPOINT "inproc://upstream"
+#define TEST_DOWNSTREAM_ENDPOINT "inproc://downstream"
+
+static void publish(zmq::socket& publisher)
+{
+    zmq::message packet;
+    packet.enqueue(TEST_TOPIC);
+    packet.enqueue(TEST_MESSAGE);
+    REQUIRE_SUCCESS(publisher.send(packet));
+}
+
+BOOST_AUTO_TEST_CASE(last_value_cache__start__valid_endpoints__true)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    const settings configuration;
+    zmq::last_value_cache cache(context, endpoint{ TEST_UPSTREAM_ENDPOINT },
+        endpoint{ TEST_DOWNSTREAM_ENDPOINT }, 1, configuration);
+    BOOST_REQUIRE(cache.start());
+    BOOST_REQUIRE(cache.stop());
+}
+
+BOOST_AUTO_TEST_CASE(last_value_cache__start__stopped_context__false)
+{
+    zmq::context context(false);
+    BOOST_REQUIRE(!context);
+
+    const settings configuration;
+    zmq::last_value_cache cache(context, endpoint{ TEST_UPSTREAM_ENDPOINT },
+        endpoint{ TEST_DOWNSTREAM_ENDPOINT }, 1, configuration);
+    BOOST_REQUIRE(!cache.start());
+}
+
+BOOST_AUTO_TEST_CASE(last_value_cache__subscribe__late_subscriber__replayed)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket publisher(context, role::publisher);
+    BOOST_REQUIRE(publisher);
+    REQUIRE_SUCCESS(publisher.bind({ TEST_UPSTREAM_ENDPOINT }));
+
+    const settings configuration;
+    zmq::last_value_cache cache(context, endpoint{ TEST_UPSTREAM_ENDPOINT },
+        endpoint{ TEST_DOWNSTREAM_ENDPOINT }, 1, configuration);
+    BOOST_REQUIRE(cache.start());
+
+    // Publish until received through the cache, so the topic is retained.
+    zmq::socket early(context, role::subscriber);
+    BOOST_REQUIRE(early);
+    REQUIRE_SUCCESS(early.connect({ TEST_DOWNSTREAM_ENDPOINT }));
+
+    zmq::poller poller;
+    poller.add(early);
+    while (!poller.wait(10).contains(early.id()))
+        publish(publisher);
+
+    // The late subscriber receives the retained message without a publish.
+    zmq::socket late(context, role::subscriber);
+    BOOST_REQUIRE(late);
+    REQUIRE_SUCCESS(late.connect({ TEST_DOWNSTREAM_ENDPOINT }));
+
+    zmq::message in;
+    REQUIRE_SUCCESS(late.receive(in));
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_TOPIC);
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE);
+    BOOST_REQUIRE(cache.stop());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -315,6 +315,23 @@ BOOST_AUTO_TEST_CASE(message__dequeue_data__two__ordered_expected)
     BOOST_REQUIRE(instance.dequeue_data() == chunk1);
 }
 
+// front
+
+BOOST_AUTO_TEST_CASE(message__front__empty__empty)
+{
+    const protocol::zmq::message instance;
+    BOOST_REQUIRE(instance.front().empty());
+}
+
+BOOST_AUTO_TEST_CASE(message__front__two__first_not_removed)
+{
+    message_fixture instance;
+    instance.queue().emplace(chunk2);
+    instance.queue().emplace(chunk1);
+    BOOST_REQUIRE(instance.front() == chunk2);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+}
+
 // dequeue_text
 
 BOOST_AUTO_TEST_CASE(message__dequeue_text__from_empty__empty)
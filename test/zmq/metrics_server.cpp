@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../utility.hpp"
+
+using namespace bc::system;
+using namespace bc::system::config;
+using namespace bc::protocol;
+using role = zmq::socket::role;
+
+BOOST_AUTO_TEST_SUITE(metrics_server_tests)
+
+using namespace std::chrono;
+
+static bool contains(const std::string& text, const std::string& line)
+{
+    return text.find(line + "\n") != std::string::npos;
+}
+
+BOOST_AUTO_TEST_CASE(metrics_server__report__no_sources__empty)
+{
+    zmq::context context;
+    const zmq::metrics_server server(context, endpoint{ TEST_PUBLIC_ENDPOINT });
+    BOOST_REQUIRE(server.report().empty());
+}
+
+BOOST_AUTO_TEST_CASE(metrics_server__report__socket_metrics__expected_samples)
+{
+    zmq::context context;
+    zmq::metrics_server server(context, endpoint{ TEST_PUBLIC_ENDPOINT });
+
+    const auto metrics = std::make_shared<zmq::socket_metrics>();
+    metrics->sent(3, false, zmq::error::success, microseconds{ 1 });
+    metrics->sent(5, true, zmq::error::success, microseconds{ 2 });
+    metrics->sent(5, true, zmq::error::try_again, microseconds{ 1'000'000 });
+    server.add("publisher", metrics);
+
+    const auto report = server.report();
+    BOOST_REQUIRE(contains(report,
+        "# TYPE bc_zmq_messages_sent_total counter"));
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_messages_sent_total{source=\"publisher\"} 1"));
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_bytes_sent_total{source=\"publisher\"} 8"));
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_send_failures_total{source=\"publisher\",error=\""
+        "try_again\"} 1"));
+    BOOST_REQUIRE(contains(report,
+        "# TYPE bc_zmq_send_seconds histogram"));
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_send_seconds_bucket{source=\"publisher\",le=\"0.000003\"} 2"));
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_send_seconds_bucket{source=\"publisher\",le=\"+Inf\"} 3"));
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_send_seconds_sum{source=\"publisher\"} 1.000003"));
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_send_seconds_count{source=\"publisher\"} 3"));
+}
+
+BOOST_AUTO_TEST_CASE(metrics_server__report__duration_at_boundary__inclusive_bucket)
+{
+    zmq::context context;
+    zmq::metrics_server server(context, endpoint{ TEST_PUBLIC_ENDPOINT });
+
+    // A 4us duration is the first of its bucket, so not within le=3us.
+    const auto metrics = std::make_shared<zmq::socket_metrics>();
+    metrics->sent(1, false, zmq::error::success, microseconds{ 3 });
+    metrics->sent(1, false, zmq::error::success, microseconds{ 4 });
+    server.add("publisher", metrics);
+
+    const auto report = server.report();
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_send_seconds_bucket{source=\"publisher\",le=\"0.000003\"} 1"));
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_send_seconds_bucket{source=\"publisher\",le=\"0.000007\"} 2"));
+}
+
+BOOST_AUTO_TEST_CASE(metrics_server__report__quoted_name__escaped)
+{
+    zmq::context context;
+    zmq::metrics_server server(context, endpoint{ TEST_PUBLIC_ENDPOINT });
+    server.add("a\"b\\c", std::make_shared<zmq::socket_metrics>());
+    BOOST_REQUIRE(contains(server.report(),
+        "bc_zmq_messages_sent_total{source=\"a\\\"b\\\\c\"} 0"));
+}
+
+BOOST_AUTO_TEST_CASE(metrics_server__report__authenticator__expected_samples)
+{
+    zmq::context context;
+    zmq::metrics_server server(context, endpoint{ TEST_PUBLIC_ENDPOINT });
+    server.add("zap", std::make_shared<zmq::authenticator>());
+
+    const auto report = server.report();
+    BOOST_REQUIRE(contains(report, "bc_zmq_zap_decisions_total"
+        "{source=\"zap\",reason=\"allowed_null\"} 0"));
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_zap_responses_total{source=\"zap\",code=\"200\"} 0"));
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_zap_pending{source=\"zap\"} 0"));
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_zap_seconds_bucket{source=\"zap\",le=\"+Inf\"} 0"));
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_zap_seconds_sum{source=\"zap\"} 0.000000"));
+    BOOST_REQUIRE(contains(report,
+        "bc_zmq_zap_seconds_count{source=\"zap\"} 0"));
+}
+
+BOOST_AUTO_TEST_CASE(metrics_server__start__stopped_context__false)
+{
+    zmq::context context(false);
+    BOOST_REQUIRE(!context);
+
+    zmq::metrics_server server(context, endpoint{ TEST_PUBLIC_ENDPOINT });
+    BOOST_REQUIRE(!server.start());
+}
+
+BOOST_AUTO_TEST_CASE(metrics_server__scrape__http_request__report_served)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::metrics_server server(context, endpoint{ TEST_PUBLIC_ENDPOINT });
+    server.add("publisher", std::make_shared<zmq::socket_metrics>());
+    BOOST_REQUIRE(server.start());
+
+    zmq::socket client(context, role::streamer);
+    BOOST_REQUIRE(client);
+    REQUIRE_SUCCESS(client.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    // The stream socket signals the connection with an empty payload.
+    zmq::message connected;
+    REQUIRE_SUCCESS(client.receive(connected));
+    const auto connection = connected.dequeue_data();
+
+    zmq::message request;
+    request.enqueue(connection);
+    request.enqueue(std::string{ "GET /metrics HTTP/1.1\r\n\r\n" });
+    REQUIRE_SUCCESS(client.send(request));
+
+    // The response may arrive in parts, followed by the disconnection.
+    std::string response{};
+    while (true)
+    {
+        zmq::message reply;
+        REQUIRE_SUCCESS(client.receive(reply));
+        BOOST_REQUIRE_EQUAL(reply.size(), 2u);
+        reply.dequeue();
+
+        const auto part = reply.dequeue_text();
+        if (part.empty())
+            break;
+
+        response += part;
+    }
+
+    BOOST_REQUIRE(response.starts_with("HTTP/1.1 200 OK\r\n"));
+    BOOST_REQUIRE(contains(response,
+        "bc_zmq_messages_sent_total{source=\"publisher\"} 0"));
+
+    BOOST_REQUIRE(client.stop());
+    BOOST_REQUIRE(server.stop());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
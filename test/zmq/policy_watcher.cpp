@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+#include <fstream>
+#include <sstream>
+
+using namespace bc::system;
+
+struct policy_watcher_setup_fixture
+{
+    DELETE_COPY_MOVE(policy_watcher_setup_fixture);
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+    policy_watcher_setup_fixture() NOEXCEPT
+    {
+        BOOST_REQUIRE(test::clear(test::directory));
+    }
+
+    ~policy_watcher_setup_fixture() NOEXCEPT
+    {
+        BOOST_REQUIRE(test::clear(test::directory));
+    }
+
+    BC_POP_WARNING()
+};
+
+BOOST_FIXTURE_TEST_SUITE(policy_watcher_tests, policy_watcher_setup_fixture)
+
+#define TEST_KEY "rq:rM>}U?@Lns47E1%kR.o@n%FcmmsL/@{H8]yf7"
+
+// parse
+
+BOOST_AUTO_TEST_CASE(policy_watcher__parse__empty__true_empty)
+{
+    std::istringstream input{ "" };
+    zmq::authenticator::rules rules{};
+    BOOST_REQUIRE(zmq::policy_watcher::parse(rules, input));
+    BOOST_REQUIRE(rules.keys.empty());
+    BOOST_REQUIRE(rules.subnets.empty());
+}
+
+BOOST_AUTO_TEST_CASE(policy_watcher__parse__comments_and_rules__expected)
+{
+    std::istringstream input
+    {
+        "# comment\n"
+        "\n"
+        "allow " TEST_KEY "\n"
+        "allow 10.0.0.0/8 # trailing\n"
+        "deny 2001:db8::/32\n"
+    };
+
+    zmq::authenticator::rules rules{};
+    BOOST_REQUIRE(zmq::policy_watcher::parse(rules, input));
+    BOOST_REQUIRE_EQUAL(rules.keys.size(), 1u);
+    BOOST_REQUIRE_EQUAL(rules.subnets.size(), 2u);
+    BOOST_REQUIRE(rules.subnets[0].first == subnet{ "10.0.0.0/8" });
+    BOOST_REQUIRE(rules.subnets[0].second);
+    BOOST_REQUIRE(rules.subnets[1].first == subnet{ "2001:db8::/32" });
+    BOOST_REQUIRE(!rules.subnets[1].second);
+}
+
+BOOST_AUTO_TEST_CASE(policy_watcher__parse__key_grant__expected)
+{
+    std::istringstream input{ "allow " TEST_KEY " alice tier=gold" };
+    zmq::authenticator::rules rules{};
+    BOOST_REQUIRE(zmq::policy_watcher::parse(rules, input));
+    BOOST_REQUIRE(rules.keys.empty());
+    BOOST_REQUIRE_EQUAL(rules.grants.size(), 1u);
+
+    const auto& grant = rules.grants.begin()->second;
+    BOOST_REQUIRE_EQUAL(grant.user_id, "alice");
+    BOOST_REQUIRE_EQUAL(grant.properties.size(), 1u);
+    BOOST_REQUIRE_EQUAL(grant.properties.front().first, "tier");
+    BOOST_REQUIRE_EQUAL(grant.properties.front().second, "gold");
+}
+
+BOOST_AUTO_TEST_CASE(policy_watcher__parse__key_user_id_after_property__false)
+{
+    std::istringstream input{ "allow " TEST_KEY " tier=gold alice" };
+    zmq::authenticator::rules rules{};
+    BOOST_REQUIRE(!zmq::policy_watcher::parse(rules, input));
+}
+
+BOOST_AUTO_TEST_CASE(policy_watcher__parse__subnet_excess__false)
+{
+    std::istringstream input{ "allow 10.0.0.0/8 alice" };
+    zmq::authenticator::rules rules{};
+    BOOST_REQUIRE(!zmq::policy_watcher::parse(rules, input));
+}
+
+BOOST_AUTO_TEST_CASE(policy_watcher__parse__unknown_action__false)
+{
+    std::istringstream input{ "permit 10.0.0.0/8" };
+    zmq::authenticator::rules rules{};
+    BOOST_REQUIRE(!zmq::policy_watcher::parse(rules, input));
+}
+
+BOOST_AUTO_TEST_CASE(policy_watcher__parse__deny_key__false)
+{
+    std::istringstream input{ "deny " TEST_KEY };
+    zmq::authenticator::rules rules{};
+    BOOST_REQUIRE(!zmq::policy_watcher::parse(rules, input));
+}
+
+BOOST_AUTO_TEST_CASE(policy_watcher__parse__key_length_subnet__subnet)
+{
+    // This subnet has the encoded length of a key (40 characters).
+    const std::string cidr{ "2001:db8:85a3:000:0000:8a2e:0370:7334/64" };
+    BOOST_REQUIRE_EQUAL(cidr.size(), zmq::zmq_encoded_key_size);
+
+    std::istringstream input{ "deny " + cidr + "\nallow " + cidr + "\n" };
+    zmq::authenticator::rules rules{};
+    BOOST_REQUIRE(zmq::policy_watcher::parse(rules, input));
+    BOOST_REQUIRE(rules.keys.empty());
+    BOOST_REQUIRE(rules.grants.empty());
+    BOOST_REQUIRE_EQUAL(rules.subnets.size(), 2u);
+    BOOST_REQUIRE(rules.subnets[0].first == subnet{ cidr });
+    BOOST_REQUIRE(!rules.subnets[0].second);
+    BOOST_REQUIRE(rules.subnets[1].first == subnet{ cidr });
+    BOOST_REQUIRE(rules.subnets[1].second);
+}
+
+BOOST_AUTO_TEST_CASE(policy_watcher__parse__invalid_subnet__false)
+{
+    std::istringstream input{ "deny 10.0.0.0/64" };
+    zmq::authenticator::rules rules{};
+    BOOST_REQUIRE(!zmq::policy_watcher::parse(rules, input));
+}
+
+// start
+
+BOOST_AUTO_TEST_CASE(policy_watcher__start__missing_file__false)
+{
+    zmq::authenticator authenticator;
+    zmq::policy_watcher instance(authenticator, TEST_PATH);
+    BOOST_REQUIRE(!instance.start());
+}
+
+BOOST_AUTO_TEST_CASE(policy_watcher__start__valid_file__true)
+{
+    BOOST_REQUIRE(test::create(TEST_PATH));
+    std::ofstream(TEST_PATH) << "deny 127.0.0.0/8" << std::endl;
+
+    zmq::authenticator authenticator;
+    zmq::policy_watcher instance(authenticator, TEST_PATH);
+    BOOST_REQUIRE(instance.start());
+    BOOST_REQUIRE(instance.stop());
+}
+
+BOOST_AUTO_TEST_CASE(policy_watcher__start__empty_file__false)
+{
+    BOOST_REQUIRE(test::create(TEST_PATH));
+
+    zmq::authenticator authenticator;
+    zmq::policy_watcher instance(authenticator, TEST_PATH);
+    BOOST_REQUIRE(!instance.start());
+}
+
+BOOST_AUTO_TEST_CASE(policy_watcher__start__comments_only__false)
+{
+    BOOST_REQUIRE(test::create(TEST_PATH));
+    std::ofstream(TEST_PATH) << "# deny 127.0.0.0/8" << std::endl;
+
+    zmq::authenticator authenticator;
+    zmq::policy_watcher instance(authenticator, TEST_PATH);
+    BOOST_REQUIRE(!instance.start());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
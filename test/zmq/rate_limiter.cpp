@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(rate_limiter_tests)
+
+using limiter_clock = zmq::rate_limiter::clock;
+
+BOOST_AUTO_TEST_CASE(rate_limiter__admit__zero_rate__always_true)
+{
+    zmq::rate_limiter instance{ 0, 1, 1 };
+    const auto now = limiter_clock::now();
+    BOOST_REQUIRE(instance.admit("a", now));
+    BOOST_REQUIRE(instance.admit("a", now));
+    BOOST_REQUIRE(is_zero(instance.size()));
+}
+
+BOOST_AUTO_TEST_CASE(rate_limiter__admit__burst_exhausted__false)
+{
+    zmq::rate_limiter instance{ 1, 2, 10 };
+    const auto now = limiter_clock::now();
+    BOOST_REQUIRE(instance.admit("a", now));
+    BOOST_REQUIRE(instance.admit("a", now));
+    BOOST_REQUIRE(!instance.admit("a", now));
+    BOOST_REQUIRE(instance.admit("b", now));
+}
+
+BOOST_AUTO_TEST_CASE(rate_limiter__admit__refilled__true)
+{
+    zmq::rate_limiter instance{ 2, 1, 10 };
+    const auto now = limiter_clock::now();
+    BOOST_REQUIRE(instance.admit("a", now));
+    BOOST_REQUIRE(!instance.admit("a", now));
+    BOOST_REQUIRE(instance.admit("a", now + std::chrono::milliseconds(500)));
+    BOOST_REQUIRE(!instance.admit("a", now + std::chrono::milliseconds(500)));
+}
+
+BOOST_AUTO_TEST_CASE(rate_limiter__admit__over_capacity__least_recent_evicted)
+{
+    zmq::rate_limiter instance{ 1, 1, 2 };
+    const auto now = limiter_clock::now();
+    BOOST_REQUIRE(instance.admit("a", now));
+    BOOST_REQUIRE(instance.admit("b", now));
+    BOOST_REQUIRE(!instance.admit("a", now));
+    BOOST_REQUIRE(instance.admit("c", now));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+
+    // b was evicted (least recently used), so it receives a new bucket.
+    BOOST_REQUIRE(instance.admit("b", now));
+    BOOST_REQUIRE(!instance.admit("c", now));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../utility.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol;
+using role = zmq::socket::role;
+
+BOOST_AUTO_TEST_SUITE(sequenced_publisher_tests)
+
+#define TEST_PUBLISHER_ENDPOINT "inproc://publisher"
+#define TEST_RECOVERY_ENDPOINT "inproc://recovery"
+
+static void publish(zmq::sequenced_publisher& publisher)
+{
+    zmq::message packet;
+    packet.enqueue(TEST_TOPIC);
+    packet.enqueue(TEST_MESSAGE);
+    REQUIRE_SUCCESS(publisher.send(packet));
+}
+
+BOOST_AUTO_TEST_CASE(sequenced_publisher__constructor__started_context__valid)
+{
+    zmq::context context;
+    const settings configuration;
+    const zmq::sequenced_publisher publisher(context, 1, configuration);
+    BOOST_REQUIRE(publisher);
+}
+
+BOOST_AUTO_TEST_CASE(sequenced_publisher__send__empty__invalid_message)
+{
+    zmq::context context;
+    const settings configuration;
+    zmq::sequenced_publisher publisher(context, 1, configuration);
+    BOOST_REQUIRE(publisher);
+
+    zmq::message packet;
+    BOOST_REQUIRE_EQUAL(publisher.send(packet), zmq::error::invalid_message);
+}
+
+BOOST_AUTO_TEST_CASE(sequenced_publisher__send__subscribed__stamped)
+{
+    zmq::context context;
+    const settings configuration;
+    zmq::sequenced_publisher publisher(context, 1, configuration);
+    BOOST_REQUIRE(publisher);
+    REQUIRE_SUCCESS(publisher.bind({ TEST_PUBLISHER_ENDPOINT },
+        { TEST_RECOVERY_ENDPOINT }));
+
+    zmq::socket subscriber(context, role::subscriber);
+    BOOST_REQUIRE(subscriber);
+    REQUIRE_SUCCESS(subscriber.connect({ TEST_PUBLISHER_ENDPOINT }));
+
+    zmq::poller poller;
+    poller.add(subscriber);
+    while (!poller.wait(10).contains(subscriber.id()))
+        publish(publisher);
+
+    zmq::message in;
+    uint64_t sequence{};
+    REQUIRE_SUCCESS(subscriber.receive(in));
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_TOPIC);
+    BOOST_REQUIRE(in.dequeue(sequence));
+    BOOST_REQUIRE_GE(sequence, 1u);
+    BOOST_REQUIRE_EQUAL(in.dequeue_text(), TEST_MESSAGE);
+}
+
+BOOST_AUTO_TEST_CASE(sequenced_publisher__retransmit__retained_range__expected)
+{
+    zmq::context context;
+    const settings configuration;
+    zmq::sequenced_publisher publisher(context, 2, configuration);
+    BOOST_REQUIRE(publisher);
+    REQUIRE_SUCCESS(publisher.bind({ TEST_PUBLISHER_ENDPOINT },
+        { TEST_RECOVERY_ENDPOINT }));
+
+    // The first of three is no longer retained.
+    publish(publisher);
+    publish(publisher);
+    publish(publisher);
+
+    zmq::socket dealer(context, role::dealer);
+    BOOST_REQUIRE(dealer);
+    REQUIRE_SUCCESS(dealer.connect({ TEST_RECOVERY_ENDPOINT }));
+
+    zmq::message request;
+    request.enqueue_little_endian<uint32_t>(42);
+    request.enqueue(TEST_TOPIC);
+    request.enqueue_little_endian<uint64_t>(1);
+    request.enqueue_little_endian<uint64_t>(2);
+    REQUIRE_SUCCESS(dealer.send(request));
+
+    zmq::poller poller;
+    poller.add(publisher.recovery());
+    BOOST_REQUIRE(poller.wait(1000).contains(publisher.recovery().id()));
+    REQUIRE_SUCCESS(publisher.retransmit());
+
+    zmq::message response;
+    uint32_t identifier{};
+    uint64_t sequence{};
+    REQUIRE_SUCCESS(dealer.receive(response));
+    BOOST_REQUIRE(response.dequeue(identifier));
+    BOOST_REQUIRE_EQUAL(identifier, 42u);
+    BOOST_REQUIRE_EQUAL(response.dequeue_text(), TEST_TOPIC);
+    BOOST_REQUIRE(response.dequeue(sequence));
+    BOOST_REQUIRE_EQUAL(sequence, 2u);
+    BOOST_REQUIRE_EQUAL(response.dequeue_text(), TEST_MESSAGE);
+
+    zmq::message terminator;
+    REQUIRE_SUCCESS(dealer.receive(terminator));
+    BOOST_REQUIRE_EQUAL(terminator.size(), 2u);
+    BOOST_REQUIRE(terminator.dequeue(identifier));
+    BOOST_REQUIRE_EQUAL(identifier, 42u);
+    BOOST_REQUIRE_EQUAL(terminator.dequeue_text(), TEST_TOPIC);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
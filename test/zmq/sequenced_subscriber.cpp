@@ -0,0 +1,265 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../utility.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol;
+using role = zmq::socket::role;
+
+BOOST_AUTO_TEST_SUITE(sequenced_subscriber_tests)
+
+#define TEST_PUBLISHER_ENDPOINT "inproc://publisher"
+#define TEST_RECOVERY_ENDPOINT "inproc://recovery"
+#define TEST_WARMUP_TOPIC "warmup"
+
+static void publish(zmq::socket& publisher, const std::string& topic,
+    uint64_t sequence)
+{
+    zmq::message packet;
+    packet.enqueue(topic);
+    packet.enqueue_little_endian<uint64_t>(sequence);
+    packet.enqueue(TEST_MESSAGE);
+    REQUIRE_SUCCESS(publisher.send(packet));
+}
+
+// Publish on another topic until subscribed, and drain the warmup messages.
+static void warmup(zmq::socket& publisher, zmq::sequenced_subscriber& instance)
+{
+    zmq::poller poller;
+    poller.add(instance.subscriber());
+    while (!poller.wait(10).contains(instance.subscriber().id()))
+        publish(publisher, TEST_WARMUP_TOPIC, 1);
+
+    data_chunk topic;
+    uint64_t sequence{};
+    zmq::message payload;
+    do
+    {
+        REQUIRE_SUCCESS(instance.receive(topic, sequence, payload));
+        BOOST_REQUIRE_EQUAL(to_string(topic), TEST_WARMUP_TOPIC);
+    } while (poller.wait(10).contains(instance.subscriber().id()));
+}
+
+BOOST_AUTO_TEST_CASE(sequenced_subscriber__constructor__started_context__valid)
+{
+    zmq::context context;
+    const settings configuration;
+    const zmq::sequenced_subscriber instance(context, 100, configuration);
+    BOOST_REQUIRE(instance);
+}
+
+BOOST_AUTO_TEST_CASE(sequenced_subscriber__receive__recoverable_gap__recovered_in_order)
+{
+    zmq::context context;
+    const settings configuration;
+
+    zmq::socket publisher(context, role::publisher);
+    BOOST_REQUIRE(publisher);
+    REQUIRE_SUCCESS(publisher.bind({ TEST_PUBLISHER_ENDPOINT }));
+
+    zmq::socket router(context, role::router);
+    BOOST_REQUIRE(router);
+    REQUIRE_SUCCESS(router.bind({ TEST_RECOVERY_ENDPOINT }));
+
+    zmq::sequenced_subscriber instance(context, 1000, configuration);
+    BOOST_REQUIRE(instance);
+    REQUIRE_SUCCESS(instance.connect({ TEST_PUBLISHER_ENDPOINT },
+        { TEST_RECOVERY_ENDPOINT }));
+
+    warmup(publisher, instance);
+
+    // Sequence two is missed.
+    publish(publisher, TEST_TOPIC, 1);
+    publish(publisher, TEST_TOPIC, 3);
+
+    simple_thread responder([&]()
+    {
+        zmq::message request;
+        zmq::message::address route;
+        uint32_t identifier{};
+        uint64_t first{};
+        uint64_t last{};
+        REQUIRE_SUCCESS(router.receive(request));
+        BOOST_REQUIRE(request.dequeue(route));
+        BOOST_REQUIRE(request.dequeue(identifier));
+        BOOST_REQUIRE_EQUAL(request.dequeue_text(), TEST_TOPIC);
+        BOOST_REQUIRE(request.dequeue(first));
+        BOOST_REQUIRE(request.dequeue(last));
+        BOOST_REQUIRE_EQUAL(first, 2u);
+        BOOST_REQUIRE_EQUAL(last, 2u);
+
+        zmq::message recovered;
+        recovered.enqueue(route);
+        recovered.enqueue_little_endian<uint32_t>(identifier);
+        recovered.enqueue(TEST_TOPIC);
+        recovered.enqueue_little_endian<uint64_t>(2);
+        recovered.enqueue(TEST_MESSAGE);
+        REQUIRE_SUCCESS(router.send(recovered));
+
+        zmq::message terminator;
+        terminator.enqueue(route);
+        terminator.enqueue_little_endian<uint32_t>(identifier);
+        terminator.enqueue(TEST_TOPIC);
+        REQUIRE_SUCCESS(router.send(terminator));
+    });
+
+    data_chunk topic;
+    uint64_t sequence{};
+    zmq::message payload;
+
+    for (uint64_t expected = 1; expected <= 3; ++expected)
+    {
+        REQUIRE_SUCCESS(instance.receive(topic, sequence, payload));
+        BOOST_REQUIRE_EQUAL(to_string(topic), TEST_TOPIC);
+        BOOST_REQUIRE_EQUAL(sequence, expected);
+        BOOST_REQUIRE_EQUAL(payload.dequeue_text(), TEST_MESSAGE);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sequenced_subscriber__receive__unrecoverable_gap__sequence_gap)
+{
+    zmq::context context;
+    const settings configuration;
+
+    zmq::socket publisher(context, role::publisher);
+    BOOST_REQUIRE(publisher);
+    REQUIRE_SUCCESS(publisher.bind({ TEST_PUBLISHER_ENDPOINT }));
+
+    zmq::socket router(context, role::router);
+    BOOST_REQUIRE(router);
+    REQUIRE_SUCCESS(router.bind({ TEST_RECOVERY_ENDPOINT }));
+
+    zmq::sequenced_subscriber instance(context, 1000, configuration);
+    BOOST_REQUIRE(instance);
+    REQUIRE_SUCCESS(instance.connect({ TEST_PUBLISHER_ENDPOINT },
+        { TEST_RECOVERY_ENDPOINT }));
+
+    warmup(publisher, instance);
+
+    // Sequence two is missed.
+    publish(publisher, TEST_TOPIC, 1);
+    publish(publisher, TEST_TOPIC, 3);
+
+    // Sequence two is not retained.
+    simple_thread responder([&]()
+    {
+        zmq::message request;
+        zmq::message::address route;
+        uint32_t identifier{};
+        REQUIRE_SUCCESS(router.receive(request));
+        BOOST_REQUIRE(request.dequeue(route));
+        BOOST_REQUIRE(request.dequeue(identifier));
+
+        zmq::message terminator;
+        terminator.enqueue(route);
+        terminator.enqueue_little_endian<uint32_t>(identifier);
+        terminator.enqueue(TEST_TOPIC);
+        REQUIRE_SUCCESS(router.send(terminator));
+    });
+
+    data_chunk topic;
+    uint64_t sequence{};
+    zmq::message payload;
+    REQUIRE_SUCCESS(instance.receive(topic, sequence, payload));
+    BOOST_REQUIRE_EQUAL(sequence, 1u);
+    BOOST_REQUIRE_EQUAL(instance.receive(topic, sequence, payload),
+        zmq::error::sequence_gap);
+    BOOST_REQUIRE_EQUAL(sequence, 2u);
+    BOOST_REQUIRE(payload.empty());
+    REQUIRE_SUCCESS(instance.receive(topic, sequence, payload));
+    BOOST_REQUIRE_EQUAL(sequence, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(sequenced_subscriber__receive__other_request_response__discarded)
+{
+    zmq::context context;
+    const settings configuration;
+
+    zmq::socket publisher(context, role::publisher);
+    BOOST_REQUIRE(publisher);
+    REQUIRE_SUCCESS(publisher.bind({ TEST_PUBLISHER_ENDPOINT }));
+
+    zmq::socket router(context, role::router);
+    BOOST_REQUIRE(router);
+    REQUIRE_SUCCESS(router.bind({ TEST_RECOVERY_ENDPOINT }));
+
+    zmq::sequenced_subscriber instance(context, 1000, configuration);
+    BOOST_REQUIRE(instance);
+    REQUIRE_SUCCESS(instance.connect({ TEST_PUBLISHER_ENDPOINT },
+        { TEST_RECOVERY_ENDPOINT }));
+
+    warmup(publisher, instance);
+
+    // Sequence two is missed.
+    publish(publisher, TEST_TOPIC, 1);
+    publish(publisher, TEST_TOPIC, 3);
+
+    // A late response of another request (same topic) precedes the response.
+    simple_thread responder([&]()
+    {
+        zmq::message request;
+        zmq::message::address route;
+        uint32_t identifier{};
+        REQUIRE_SUCCESS(router.receive(request));
+        BOOST_REQUIRE(request.dequeue(route));
+        BOOST_REQUIRE(request.dequeue(identifier));
+
+        zmq::message stale;
+        stale.enqueue(route);
+        stale.enqueue_little_endian<uint32_t>(add1(identifier));
+        stale.enqueue(TEST_TOPIC);
+        stale.enqueue_little_endian<uint64_t>(2);
+        stale.enqueue("stale");
+        REQUIRE_SUCCESS(router.send(stale));
+
+        zmq::message stale_terminator;
+        stale_terminator.enqueue(route);
+        stale_terminator.enqueue_little_endian<uint32_t>(add1(identifier));
+        stale_terminator.enqueue(TEST_TOPIC);
+        REQUIRE_SUCCESS(router.send(stale_terminator));
+
+        zmq::message recovered;
+        recovered.enqueue(route);
+        recovered.enqueue_little_endian<uint32_t>(identifier);
+        recovered.enqueue(TEST_TOPIC);
+        recovered.enqueue_little_endian<uint64_t>(2);
+        recovered.enqueue(TEST_MESSAGE);
+        REQUIRE_SUCCESS(router.send(recovered));
+
+        zmq::message terminator;
+        terminator.enqueue(route);
+        terminator.enqueue_little_endian<uint32_t>(identifier);
+        terminator.enqueue(TEST_TOPIC);
+        REQUIRE_SUCCESS(router.send(terminator));
+    });
+
+    data_chunk topic;
+    uint64_t sequence{};
+    zmq::message payload;
+
+    for (uint64_t expected = 1; expected <= 3; ++expected)
+    {
+        REQUIRE_SUCCESS(instance.receive(topic, sequence, payload));
+        BOOST_REQUIRE_EQUAL(sequence, expected);
+        BOOST_REQUIRE_EQUAL(payload.dequeue_text(), TEST_MESSAGE);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -28,6 +28,102 @@ BOOST_AUTO_TEST_SUITE(socket_tests)
 // See for zeromq curve pattern: hintjens.com/blog:49
 // brickhouse = stonehouse - strawhouse (private and anonymous)
 
+// Access protected members.
+class socket_fixture
+  : public zmq::socket
+{
+public:
+    static int32_t reconnect_interval(uint32_t milliseconds, uint32_t jitter)
+    {
+        return zmq::socket::reconnect_interval(milliseconds, jitter);
+    }
+};
+
+static int32_t get_reconnect_interval(zmq::socket& socket)
+{
+    int32_t value{};
+    auto size = sizeof(value);
+    BOOST_REQUIRE_NE(zmq_getsockopt(socket.self(), ZMQ_RECONNECT_IVL, &value,
+        &size), zmq::zmq_fail);
+    return value;
+}
+
+// reconnect_interval
+
+BOOST_AUTO_TEST_CASE(socket__reconnect_interval__zero__default)
+{
+    BOOST_REQUIRE_EQUAL(socket_fixture::reconnect_interval(0, 0),
+        zmq::zmq_reconnect_interval);
+}
+
+BOOST_AUTO_TEST_CASE(socket__reconnect_interval__no_jitter__unchanged)
+{
+    BOOST_REQUIRE_EQUAL(socket_fixture::reconnect_interval(250, 0), 250);
+}
+
+BOOST_AUTO_TEST_CASE(socket__reconnect_interval__jitter__within_percent)
+{
+    for (auto count = 0; count < 1000; ++count)
+    {
+        const auto interval = socket_fixture::reconnect_interval(200, 25);
+        BOOST_REQUIRE_GE(interval, 200);
+        BOOST_REQUIRE_LE(interval, 250);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(socket__reconnect_interval__default_with_jitter__within_percent)
+{
+    for (auto count = 0; count < 1000; ++count)
+    {
+        const auto interval = socket_fixture::reconnect_interval(0, 100);
+        BOOST_REQUIRE_GE(interval, zmq::zmq_reconnect_interval);
+        BOOST_REQUIRE_LE(interval, 2 * zmq::zmq_reconnect_interval);
+    }
+}
+
+// constructor
+
+BOOST_AUTO_TEST_CASE(socket__constructor__reconnect_interval__set)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    settings configuration;
+    configuration.reconnect_milliseconds = 250;
+    zmq::socket subscriber(context, role::subscriber, configuration);
+    BOOST_REQUIRE(subscriber);
+    BOOST_REQUIRE_EQUAL(get_reconnect_interval(subscriber), 250);
+}
+
+BOOST_AUTO_TEST_CASE(socket__constructor__reconnect_jitter__valid)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    settings configuration;
+    configuration.reconnect_milliseconds = 250;
+    configuration.reconnect_jitter = 100;
+    zmq::socket subscriber(context, role::subscriber, configuration);
+    BOOST_REQUIRE(subscriber);
+
+    const auto interval = get_reconnect_interval(subscriber);
+    BOOST_REQUIRE_GE(interval, 250);
+    BOOST_REQUIRE_LE(interval, 500);
+}
+
+BOOST_AUTO_TEST_CASE(socket__constructor__reconnect_disabled_with_jitter__valid)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    settings configuration;
+    configuration.reconnect_seconds = 0;
+    configuration.reconnect_jitter = 50;
+    zmq::socket subscriber(context, role::subscriber, configuration);
+    BOOST_REQUIRE(subscriber);
+    BOOST_REQUIRE_EQUAL(get_reconnect_interval(subscriber), -1);
+}
+
 // TODO: verify that missing authenticator should succeed/fail here.
 // There is no authenticator running, so this blocks despite configuration.
 BOOST_AUTO_TEST_CASE(socket__push_pull__brickhouse__received)
@@ -1314,4 +1410,106 @@ BOOST_AUTO_TEST_CASE(socket__dealer_router_dealer_dealer_and_dealer_undelimited_
     ////dealer.stop();
 }
 
+// fan-out
+
+BOOST_AUTO_TEST_CASE(socket__push_pull__shared_message__received_by_all)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket pusher1(context, role::pusher);
+    zmq::socket pusher2(context, role::pusher);
+    zmq::socket puller1(context, role::puller);
+    zmq::socket puller2(context, role::puller);
+    REQUIRE_SUCCESS(pusher1.bind({ "inproc://fanout1" }));
+    REQUIRE_SUCCESS(pusher2.bind({ "inproc://fanout2" }));
+    REQUIRE_SUCCESS(puller1.connect({ "inproc://fanout1" }));
+    REQUIRE_SUCCESS(puller2.connect({ "inproc://fanout2" }));
+
+    zmq::message out;
+    out.enqueue(TEST_TOPIC);
+    out.enqueue(TEST_MESSAGE);
+    REQUIRE_SUCCESS(out.send(zmq::sockets{ pusher1, pusher2 }));
+    BOOST_REQUIRE(out.empty());
+
+    zmq::message in1;
+    REQUIRE_SUCCESS(puller1.receive(in1));
+    BOOST_REQUIRE_EQUAL(in1.dequeue_text(), TEST_TOPIC);
+    BOOST_REQUIRE_EQUAL(in1.dequeue_text(), TEST_MESSAGE);
+
+    zmq::message in2;
+    REQUIRE_SUCCESS(puller2.receive(in2));
+    BOOST_REQUIRE_EQUAL(in2.dequeue_text(), TEST_TOPIC);
+    BOOST_REQUIRE_EQUAL(in2.dequeue_text(), TEST_MESSAGE);
+}
+
+// metrics
+
+BOOST_AUTO_TEST_CASE(socket__metrics__default__null)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket pusher(context, role::pusher);
+    BOOST_REQUIRE(is_null(pusher.metrics()));
+}
+
+BOOST_AUTO_TEST_CASE(socket__push_pull__metrics__counted)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    const auto sent = std::make_shared<zmq::socket_metrics>();
+    const auto received = std::make_shared<zmq::socket_metrics>();
+    zmq::socket pusher(context, role::pusher);
+    zmq::socket puller(context, role::puller);
+    pusher.set_metrics(sent);
+    puller.set_metrics(received);
+    REQUIRE_SUCCESS(pusher.bind({ TEST_INPROC_ENDPOINT }));
+    REQUIRE_SUCCESS(puller.connect({ TEST_INPROC_ENDPOINT }));
+
+    zmq::message out;
+    out.enqueue(TEST_TOPIC);
+    out.enqueue(TEST_MESSAGE);
+    REQUIRE_SUCCESS(pusher.send(out));
+
+    zmq::message in;
+    REQUIRE_SUCCESS(puller.receive(in));
+
+    const auto bytes = std::string{ TEST_TOPIC }.size() +
+        std::string{ TEST_MESSAGE }.size();
+    const auto out_metrics = sent->get();
+    BOOST_REQUIRE_EQUAL(out_metrics.messages_sent, 1u);
+    BOOST_REQUIRE_EQUAL(out_metrics.bytes_sent, bytes);
+    BOOST_REQUIRE_EQUAL(out_metrics.send_latency.count, 2u);
+    BOOST_REQUIRE(is_zero(out_metrics.messages_received));
+
+    const auto in_metrics = received->get();
+    BOOST_REQUIRE_EQUAL(in_metrics.messages_received, 1u);
+    BOOST_REQUIRE_EQUAL(in_metrics.bytes_received, bytes);
+    BOOST_REQUIRE_EQUAL(in_metrics.receive_latency.count, 2u);
+    BOOST_REQUIRE(is_zero(in_metrics.messages_sent));
+}
+
+BOOST_AUTO_TEST_CASE(socket__send__metrics_no_peer__try_again_counted)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    settings configuration;
+    configuration.send_milliseconds = 1;
+    const auto metrics = std::make_shared<zmq::socket_metrics>();
+    zmq::socket pusher(context, role::pusher, configuration);
+    pusher.set_metrics(metrics);
+
+    zmq::message out;
+    out.enqueue(TEST_MESSAGE);
+    BOOST_REQUIRE_EQUAL(pusher.send(out), zmq::error::try_again);
+
+    const auto snapshot = metrics->get();
+    BOOST_REQUIRE(is_zero(snapshot.messages_sent));
+    BOOST_REQUIRE_EQUAL(snapshot.send_failures[zmq::error::try_again], 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.send_latency.count, 1u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol;
+
+BOOST_AUTO_TEST_SUITE(socket_metrics_tests)
+
+using namespace std::chrono;
+
+BOOST_AUTO_TEST_CASE(socket_metrics__get__default__zeroed)
+{
+    const zmq::socket_metrics instance{};
+    const auto snapshot = instance.get();
+    BOOST_REQUIRE(is_zero(snapshot.messages_sent));
+    BOOST_REQUIRE(is_zero(snapshot.bytes_sent));
+    BOOST_REQUIRE(is_zero(snapshot.messages_received));
+    BOOST_REQUIRE(is_zero(snapshot.bytes_received));
+    BOOST_REQUIRE(is_zero(snapshot.receive_failures));
+    BOOST_REQUIRE(is_zero(snapshot.send_latency.count));
+    BOOST_REQUIRE(is_zero(snapshot.receive_latency.count));
+}
+
+BOOST_AUTO_TEST_CASE(socket_metrics__sent__parts__last_completes_message)
+{
+    zmq::socket_metrics instance{};
+    instance.sent(3, false, zmq::error::success, microseconds{ 1 });
+    instance.sent(5, true, zmq::error::success, microseconds{ 2 });
+
+    const auto snapshot = instance.get();
+    BOOST_REQUIRE_EQUAL(snapshot.messages_sent, 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.bytes_sent, 8u);
+    BOOST_REQUIRE_EQUAL(snapshot.send_latency.count, 2u);
+    BOOST_REQUIRE_EQUAL(snapshot.send_latency.sum, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(socket_metrics__sent__failures__counted_by_code)
+{
+    zmq::socket_metrics instance{};
+    instance.sent(3, true, zmq::error::try_again, microseconds{ 1 });
+    instance.sent(3, true, zmq::error::try_again, microseconds{ 1 });
+    instance.sent(3, true, zmq::error::context_terminated, microseconds{ 1 });
+
+    const auto snapshot = instance.get();
+    BOOST_REQUIRE(is_zero(snapshot.messages_sent));
+    BOOST_REQUIRE(is_zero(snapshot.bytes_sent));
+    BOOST_REQUIRE_EQUAL(snapshot.send_failures[zmq::error::try_again], 2u);
+    BOOST_REQUIRE_EQUAL(
+        snapshot.send_failures[zmq::error::context_terminated], 1u);
+}
+
+BOOST_AUTO_TEST_CASE(socket_metrics__received__failure__counted)
+{
+    zmq::socket_metrics instance{};
+    instance.received(4, true, zmq::error::success, microseconds{ 1 });
+    instance.received(0, true, zmq::error::try_again, microseconds{ 1 });
+
+    const auto snapshot = instance.get();
+    BOOST_REQUIRE_EQUAL(snapshot.messages_received, 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.bytes_received, 4u);
+    BOOST_REQUIRE_EQUAL(snapshot.receive_failures, 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.receive_latency.count, 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../utility.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol;
+using role = zmq::socket::role;
+using type = zmq::socket_monitor::event_type;
+
+BOOST_AUTO_TEST_SUITE(socket_monitor_tests)
+
+static size_t count(const zmq::socket_monitor& monitor, type event)
+{
+    return possible_narrow_cast<size_t>(
+        monitor.metrics().events[static_cast<size_t>(event)]);
+}
+
+BOOST_AUTO_TEST_CASE(socket_monitor__start__valid_socket__true)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket socket(context, role::puller);
+    BOOST_REQUIRE(socket);
+
+    zmq::socket_monitor monitor(context, socket);
+    BOOST_REQUIRE(monitor.start());
+    BOOST_REQUIRE(socket.stop());
+    BOOST_REQUIRE(monitor.stop());
+}
+
+BOOST_AUTO_TEST_CASE(socket_monitor__metrics__not_started__zeroed)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket socket(context, role::puller);
+    BOOST_REQUIRE(socket);
+
+    const zmq::socket_monitor monitor(context, socket);
+    const auto snapshot = monitor.metrics();
+    BOOST_REQUIRE(is_zero(snapshot.handshakes.count));
+
+    for (const auto value: snapshot.events)
+        BOOST_REQUIRE(is_zero(value));
+}
+
+BOOST_AUTO_TEST_CASE(socket_monitor__pop__tcp_connect__handshake_observed)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket server(context, role::puller);
+    BOOST_REQUIRE(server);
+
+    std::atomic<size_t> notified{};
+    zmq::socket_monitor monitor(context, server, [&](const auto&)
+    {
+        ++notified;
+    }, 16);
+
+    BOOST_REQUIRE(monitor.start());
+    REQUIRE_SUCCESS(server.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    zmq::socket client(context, role::pusher);
+    BOOST_REQUIRE(client);
+    REQUIRE_SUCCESS(client.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    SEND_MESSAGE(client);
+    RECEIVE_MESSAGE(server);
+
+    // The handshake precedes delivery, but its event is reported separately.
+    while (is_zero(count(monitor, type::handshake_succeeded)))
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    BOOST_REQUIRE_EQUAL(count(monitor, type::listening), 1u);
+    BOOST_REQUIRE_EQUAL(count(monitor, type::accepted), 1u);
+    BOOST_REQUIRE_EQUAL(monitor.metrics().handshakes.count, 1u);
+    BOOST_REQUIRE_GE(notified.load(), 3u);
+
+    zmq::socket_monitor::event event{};
+    BOOST_REQUIRE(monitor.pop(event));
+    BOOST_REQUIRE(event.type == type::listening);
+    BOOST_REQUIRE(monitor.pop(event));
+    BOOST_REQUIRE(event.type == type::accepted);
+    BOOST_REQUIRE(monitor.pop(event));
+    BOOST_REQUIRE(event.type == type::handshake_succeeded);
+
+    BOOST_REQUIRE(client.stop());
+    BOOST_REQUIRE(server.stop());
+    BOOST_REQUIRE(monitor.stop());
+}
+
+BOOST_AUTO_TEST_CASE(socket_monitor__metrics__dropped_before_handshake__not_inflated)
+{
+    zmq::context context;
+    BOOST_REQUIRE(context);
+
+    zmq::socket server(context, role::puller);
+    BOOST_REQUIRE(server);
+
+    zmq::socket_monitor monitor(context, server, {}, 16);
+    BOOST_REQUIRE(monitor.start());
+    REQUIRE_SUCCESS(server.bind({ TEST_PUBLIC_ENDPOINT }));
+
+    // A raw tcp connection that closes without a zmtp handshake.
+    zmq::socket probe(context, role::streamer);
+    BOOST_REQUIRE(probe);
+    REQUIRE_SUCCESS(probe.connect({ TEST_PUBLIC_ENDPOINT }));
+
+    while (is_zero(count(monitor, type::accepted)))
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    BOOST_REQUIRE(probe.stop());
+
+    while (is_zero(count(monitor, type::disconnected)))
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    // A stale probe time would inflate the next handshake by this delay.
+    constexpr auto delay = std::chrono::milliseconds(500);
+    std::this_thread::sleep_for(delay);
+
+    zmq::socket client(context, role::pusher);
+    BOOST_REQUIRE(client);
+    REQUIRE_SUCCESS(client.connect({ TEST_PUBLIC_ENDPOINT }));
+    SEND_MESSAGE(client);
+    RECEIVE_MESSAGE(server);
+
+    while (is_zero(count(monitor, type::handshake_succeeded)))
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    zmq::socket_monitor::event event{};
+    do
+    {
+        BOOST_REQUIRE(monitor.pop(event));
+    } while (event.type != type::handshake_succeeded);
+
+    BOOST_REQUIRE(event.handshake < delay);
+
+    BOOST_REQUIRE(client.stop());
+    BOOST_REQUIRE(server.stop());
+    BOOST_REQUIRE(monitor.stop());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
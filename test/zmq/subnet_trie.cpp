@@ -0,0 +1,226 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::system;
+using namespace bc::protocol;
+
+BOOST_AUTO_TEST_SUITE(subnet_trie_tests)
+
+static ip_address normal(const std::string& host)
+{
+    ip_address out{};
+    BOOST_REQUIRE(subnet::normalize(out, host));
+    return out;
+}
+
+// subnet
+
+BOOST_AUTO_TEST_CASE(subnet_trie__subnet_normalize__ipv4_and_mapped_ipv6__equal)
+{
+    BOOST_REQUIRE(normal("127.0.0.1") == normal("::ffff:127.0.0.1"));
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__subnet_normalize__bracketed_ipv6__true)
+{
+    BOOST_REQUIRE(normal("[::1]") == normal("::1"));
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__subnet_normalize__invalid__false)
+{
+    ip_address out{};
+    BOOST_REQUIRE(!subnet::normalize(out, "localhost"));
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__subnet_construct__ipv4_cidr__expected)
+{
+    const subnet instance{ "10.1.2.3/8" };
+    BOOST_REQUIRE_EQUAL(instance.prefix(), 104u);
+    BOOST_REQUIRE_EQUAL(instance.to_string(), "10.0.0.0/8");
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__subnet_construct__ipv6_cidr__expected)
+{
+    const subnet instance{ "2001:db8::1/32" };
+    BOOST_REQUIRE_EQUAL(instance.prefix(), 32u);
+    BOOST_REQUIRE_EQUAL(instance.to_string(), "2001:db8::/32");
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__subnet_construct__host__full_prefix)
+{
+    const subnet instance{ "192.168.0.1" };
+    BOOST_REQUIRE_EQUAL(instance.prefix(), subnet::maximum_prefix);
+    BOOST_REQUIRE_EQUAL(instance.to_string(), "192.168.0.1/32");
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__subnet_construct__excess_prefix__throws)
+{
+    BOOST_REQUIRE_THROW(subnet{ "10.0.0.0/33" }, istream_exception);
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__subnet_contains__inside_and_outside__expected)
+{
+    const subnet instance{ "10.0.0.0/8" };
+    BOOST_REQUIRE(instance.contains(normal("10.255.0.1")));
+    BOOST_REQUIRE(!instance.contains(normal("11.0.0.1")));
+}
+
+// insert/find
+
+BOOST_AUTO_TEST_CASE(subnet_trie__find__empty__false)
+{
+    zmq::subnet_trie instance;
+    auto allow = true;
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE(!instance.find(allow, normal("10.0.0.1")));
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__find__within_prefix__found)
+{
+    zmq::subnet_trie instance;
+    BOOST_REQUIRE(instance.insert(subnet{ "10.0.0.0/8" }, false));
+
+    auto allow = true;
+    BOOST_REQUIRE(instance.find(allow, normal("10.1.2.3")));
+    BOOST_REQUIRE(!allow);
+    BOOST_REQUIRE(!instance.find(allow, normal("11.1.2.3")));
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__find__longest_prefix__wins)
+{
+    zmq::subnet_trie instance;
+    BOOST_REQUIRE(instance.insert(subnet{ "10.0.0.0/8" }, false));
+    BOOST_REQUIRE(instance.insert(subnet{ "10.1.0.0/16" }, true));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+
+    auto allow = false;
+    BOOST_REQUIRE(instance.find(allow, normal("10.1.2.3")));
+    BOOST_REQUIRE(allow);
+    BOOST_REQUIRE(instance.find(allow, normal("10.2.2.3")));
+    BOOST_REQUIRE(!allow);
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__insert__duplicate__first_retained)
+{
+    zmq::subnet_trie instance;
+    BOOST_REQUIRE(instance.insert(subnet{ "::1" }, false));
+    BOOST_REQUIRE(!instance.insert(subnet{ "::1" }, true));
+
+    auto allow = true;
+    BOOST_REQUIRE(instance.find(allow, normal("::1")));
+    BOOST_REQUIRE(!allow);
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__find__zero_prefix__matches_all)
+{
+    zmq::subnet_trie instance;
+    BOOST_REQUIRE(instance.insert(subnet{ "::/0" }, true));
+
+    auto allow = false;
+    BOOST_REQUIRE(instance.find(allow, normal("2001:db8::1")));
+    BOOST_REQUIRE(instance.find(allow, normal("1.2.3.4")));
+    BOOST_REQUIRE(allow);
+}
+
+// erase
+
+BOOST_AUTO_TEST_CASE(subnet_trie__erase__existing__removed)
+{
+    zmq::subnet_trie instance;
+    BOOST_REQUIRE(instance.insert(subnet{ "10.0.0.0/8" }, false));
+    BOOST_REQUIRE(instance.erase(subnet{ "10.0.0.0/8" }));
+    BOOST_REQUIRE(instance.empty());
+
+    auto allow = true;
+    BOOST_REQUIRE(!instance.find(allow, normal("10.1.2.3")));
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__erase__missing__false)
+{
+    zmq::subnet_trie instance;
+    BOOST_REQUIRE(instance.insert(subnet{ "10.0.0.0/8" }, false));
+    BOOST_REQUIRE(!instance.erase(subnet{ "10.0.0.0/16" }));
+    BOOST_REQUIRE(!instance.erase(subnet{ "11.0.0.0/8" }));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__erase__within_path__others_retained)
+{
+    zmq::subnet_trie instance;
+    BOOST_REQUIRE(instance.insert(subnet{ "10.0.0.0/8" }, false));
+    BOOST_REQUIRE(instance.insert(subnet{ "10.1.0.0/16" }, true));
+    BOOST_REQUIRE(instance.insert(subnet{ "10.2.0.0/16" }, true));
+    BOOST_REQUIRE(instance.erase(subnet{ "10.0.0.0/8" }));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+
+    auto allow = false;
+    BOOST_REQUIRE(instance.find(allow, normal("10.1.2.3")));
+    BOOST_REQUIRE(allow);
+    BOOST_REQUIRE(instance.find(allow, normal("10.2.2.3")));
+    BOOST_REQUIRE(allow);
+    BOOST_REQUIRE(!instance.find(allow, normal("10.3.2.3")));
+}
+
+// nodes
+
+BOOST_AUTO_TEST_CASE(subnet_trie__nodes__host_rules__independent_of_prefix)
+{
+    zmq::subnet_trie instance;
+    BOOST_REQUIRE(instance.insert(subnet{ "2001:db8::1" }, true));
+    BOOST_REQUIRE_EQUAL(instance.nodes(), 2u);
+    BOOST_REQUIRE(instance.insert(subnet{ "2001:db8::2" }, true));
+    BOOST_REQUIRE_EQUAL(instance.nodes(), 4u);
+
+    auto allow = false;
+    BOOST_REQUIRE(instance.find(allow, normal("2001:db8::1")));
+    BOOST_REQUIRE(instance.find(allow, normal("2001:db8::2")));
+    BOOST_REQUIRE(!instance.find(allow, normal("2001:db8::3")));
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__nodes__erase_all__reclaimed)
+{
+    zmq::subnet_trie instance;
+    BOOST_REQUIRE(instance.insert(subnet{ "10.0.0.0/8" }, false));
+    BOOST_REQUIRE(instance.insert(subnet{ "10.1.0.0/16" }, true));
+    BOOST_REQUIRE(instance.insert(subnet{ "192.168.0.1" }, true));
+    BOOST_REQUIRE(instance.erase(subnet{ "10.1.0.0/16" }));
+    BOOST_REQUIRE(instance.erase(subnet{ "192.168.0.1" }));
+    BOOST_REQUIRE(instance.erase(subnet{ "10.0.0.0/8" }));
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.nodes(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(subnet_trie__nodes__erase_and_insert__reused)
+{
+    zmq::subnet_trie instance;
+    BOOST_REQUIRE(instance.insert(subnet{ "10.0.0.1" }, true));
+    BOOST_REQUIRE(instance.insert(subnet{ "10.0.0.2" }, true));
+    const auto nodes = instance.nodes();
+
+    for (auto count = 0; count < 100; ++count)
+    {
+        BOOST_REQUIRE(instance.erase(subnet{ "10.0.0.2" }));
+        BOOST_REQUIRE(instance.insert(subnet{ "10.0.0.2" }, true));
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.nodes(), nodes);
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
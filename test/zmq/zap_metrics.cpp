@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2011-2025 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+using namespace bc::system;
+
+BOOST_AUTO_TEST_SUITE(zap_metrics_tests)
+
+using namespace std::chrono;
+
+BOOST_AUTO_TEST_CASE(zap_metrics__get__default__zeroed)
+{
+    const zmq::zap_metrics instance{};
+    const auto snapshot = instance.get();
+    BOOST_REQUIRE(is_zero(snapshot.success));
+    BOOST_REQUIRE(is_zero(snapshot.temporary));
+    BOOST_REQUIRE(is_zero(snapshot.failure));
+    BOOST_REQUIRE(is_zero(snapshot.internal));
+    BOOST_REQUIRE(is_zero(snapshot.pending));
+    BOOST_REQUIRE(is_zero(snapshot.latency.count));
+}
+
+BOOST_AUTO_TEST_CASE(zap_metrics__record__codes__expected_counts)
+{
+    zmq::zap_metrics instance{};
+    instance.record(0, 200, microseconds{ 0 });
+    instance.record(2, 400, microseconds{ 1 });
+    instance.record(2, 400, microseconds{ 1 });
+    instance.record(13, 300, microseconds{ 1 });
+    instance.record(12, 500, microseconds{ 4 });
+
+    const auto snapshot = instance.get();
+    BOOST_REQUIRE_EQUAL(snapshot.success, 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.temporary, 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.failure, 2u);
+    BOOST_REQUIRE_EQUAL(snapshot.internal, 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.decisions[0], 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.decisions[2], 2u);
+    BOOST_REQUIRE_EQUAL(snapshot.decisions[12], 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.decisions[13], 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.latency.count, 5u);
+    BOOST_REQUIRE_EQUAL(snapshot.latency.sum, 7u);
+    BOOST_REQUIRE_EQUAL(snapshot.latency.counts[0], 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.latency.counts[1], 3u);
+    BOOST_REQUIRE_EQUAL(snapshot.latency.counts[
+        zmq::histogram::bucket(4)], 1u);
+}
+
+BOOST_AUTO_TEST_CASE(zap_metrics__record__invalid_reason__code_counted)
+{
+    zmq::zap_metrics instance{};
+    instance.record(zmq::zap_metrics::reasons, 400, microseconds{ 0 });
+
+    const auto snapshot = instance.get();
+    BOOST_REQUIRE_EQUAL(snapshot.failure, 1u);
+    BOOST_REQUIRE_EQUAL(snapshot.latency.counts[0], 1u);
+}
+
+BOOST_AUTO_TEST_CASE(zap_metrics__set_pending__value__expected)
+{
+    zmq::zap_metrics instance{};
+    instance.set_pending(42);
+    BOOST_REQUIRE_EQUAL(instance.get().pending, 42u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()